@@ -0,0 +1,243 @@
+#include <stm32f4xx.h>
+#include <stm32f4xx_conf.h>
+#include <drv_i2c.h>
+#include <mpu6050.h>
+#include <fastmath.h>
+#include <ahrs.h>
+#include <system.h>
+#include <ccm.h>
+
+/*
+ *  -	 "http://x-io.co.uk/open-source-imu-and-ahrs-algorithms/"
+ */
+
+#define AHRS_GYRO_SCALE     ((float)(GYROScaleFactor / RAD_TO_DEG)) // LSB -> rad/s
+#define AHRS_DT_MIN_RATIO   0.5f //  dt Ī ֱ    Ī ֱ⸦ 
+#define AHRS_DT_MAX_RATIO   2.0f
+
+/*
+ * @brief ڼ 
+ */
+static ahrsInitTypeDef_t ahrsConfig;
+static float ahrsDt; // Ī ֱ()
+
+/*
+ * @brief ʹϾ, ǥ -> üǥ
+ */
+static float q0 CCM_DATA = 1.0f, q1 CCM_DATA = 0.0f, q2 CCM_DATA = 0.0f, q3 CCM_DATA = 0.0f;
+
+/*
+ * @brief mahony  
+ */
+static float integralX CCM_BSS, integralY CCM_BSS, integralZ CCM_BSS;
+
+/*
+ * @brief   ð ҿ Ŭ
+ */
+static uint32_t ahrsLastTime = 0;
+static uint8_t ahrsFirstUpdate = 1;
+static uint32_t ahrsUpdateCycles = 0;
+
+/*
+ * @brief ڼ ʱȭ ü ʱ⼳
+ * @param ahrsInitStruct: ʱ⼳ ڼ ʱȭ ü 
+ * @retval 
+ */
+void ahrsStructInit(ahrsInitTypeDef_t* ahrsInitStruct) {
+	ahrsInitStruct->type = AHRS_MAHONY;
+	ahrsInitStruct->sampleHz = 1000.0f;
+	ahrsInitStruct->kp = 0.5f;
+	ahrsInitStruct->ki = 0.0f;
+	ahrsInitStruct->beta = 0.1f;
+}
+
+/*
+ * @brief ڼ ʱȭ
+ * @param ahrsInitStruct: ڼ ʱȭ ü 
+ * @retval 
+ */
+void ahrsInit(ahrsInitTypeDef_t* ahrsInitStruct) {
+	ahrsConfig = *ahrsInitStruct;
+	ahrsDt = 1.0f / ahrsConfig.sampleHz;
+
+	q0 = 1.0f; q1 = 0.0f; q2 = 0.0f; q3 = 0.0f;
+	integralX = 0.0f; integralY = 0.0f; integralZ = 0.0f;
+	ahrsFirstUpdate = 1;
+}
+
+/*
+ * @brief mahony  
+ * @param gx, gy, gz: ̷(rad/s)
+ * @param ax, ay, az: ӵ( )
+ * @param dt: ֱ()
+ * @retval 
+ */
+static void ahrsMahonyUpdate(float gx, float gy, float gz, float ax, float ay, float az, float dt) {
+	if(!((ax == 0.0f) && (ay == 0.0f) && (az == 0.0f))) {
+		const float recipNorm = invSqrt(ax * ax + ay * ay + az * az);
+		ax *= recipNorm;
+		ay *= recipNorm;
+		az *= recipNorm;
+
+		// ʹϾ  ߷  
+		const float halfvx = q1 * q3 - q0 * q2;
+		const float halfvy = q0 * q1 + q2 * q3;
+		const float halfvz = q0 * q0 - 0.5f + q3 * q3;
+
+		//  ߷   
+		const float halfex = ay * halfvz - az * halfvy;
+		const float halfey = az * halfvx - ax * halfvz;
+		const float halfez = ax * halfvy - ay * halfvx;
+
+		if(ahrsConfig.ki > 0.0f) {
+			integralX += 2.0f * ahrsConfig.ki * halfex * dt;
+			integralY += 2.0f * ahrsConfig.ki * halfey * dt;
+			integralZ += 2.0f * ahrsConfig.ki * halfez * dt;
+			gx += integralX;
+			gy += integralY;
+			gz += integralZ;
+		}
+
+		gx += 2.0f * ahrsConfig.kp * halfex;
+		gy += 2.0f * ahrsConfig.kp * halfey;
+		gz += 2.0f * ahrsConfig.kp * halfez;
+	}
+
+	// ʹϾ ̺ 
+	gx *= 0.5f * dt;
+	gy *= 0.5f * dt;
+	gz *= 0.5f * dt;
+	const float qa = q0, qb = q1, qc = q2;
+	q0 += (-qb * gx - qc * gy - q3 * gz);
+	q1 += (qa * gx + qc * gz - q3 * gy);
+	q2 += (qa * gy - qb * gz + q3 * gx);
+	q3 += (qa * gz + qb * gy - qc * gx);
+}
+
+/*
+ * @brief madgwick ϰ  
+ * @param gx, gy, gz: ̷(rad/s)
+ * @param ax, ay, az: ӵ( )
+ * @param dt: ֱ()
+ * @retval 
+ */
+static void ahrsMadgwickUpdate(float gx, float gy, float gz, float ax, float ay, float az, float dt) {
+	// ̷ο  ʹϾ ȭ
+	float qDot1 = 0.5f * (-q1 * gx - q2 * gy - q3 * gz);
+	float qDot2 = 0.5f * (q0 * gx + q2 * gz - q3 * gy);
+	float qDot3 = 0.5f * (q0 * gy - q1 * gz + q3 * gx);
+	float qDot4 = 0.5f * (q0 * gz + q1 * gy - q2 * gx);
+
+	if(!((ax == 0.0f) && (ay == 0.0f) && (az == 0.0f))) {
+		float recipNorm = invSqrt(ax * ax + ay * ay + az * az);
+		ax *= recipNorm;
+		ay *= recipNorm;
+		az *= recipNorm;
+
+		const float _2q0 = 2.0f * q0, _2q1 = 2.0f * q1, _2q2 = 2.0f * q2, _2q3 = 2.0f * q3;
+		const float _4q0 = 4.0f * q0, _4q1 = 4.0f * q1, _4q2 = 4.0f * q2;
+		const float _8q1 = 8.0f * q1, _8q2 = 8.0f * q2;
+		const float q0q0 = q0 * q0, q1q1 = q1 * q1, q2q2 = q2 * q2, q3q3 = q3 * q3;
+
+		// Լ 
+		float s0 = _4q0 * q2q2 + _2q2 * ax + _4q0 * q1q1 - _2q1 * ay;
+		float s1 = _4q1 * q3q3 - _2q3 * ax + 4.0f * q0q0 * q1 - _2q0 * ay - _4q1 + _8q1 * q1q1 + _8q1 * q2q2 + _4q1 * az;
+		float s2 = 4.0f * q0q0 * q2 + _2q0 * ax + _4q2 * q3q3 - _2q3 * ay - _4q2 + _8q2 * q1q1 + _8q2 * q2q2 + _4q2 * az;
+		float s3 = 4.0f * q1q1 * q3 - _2q1 * ax + 4.0f * q2q2 * q3 - _2q2 * ay;
+		const float normS = s0 * s0 + s1 * s1 + s2 * s2 + s3 * s3;
+		if(normS > 0.0f) {
+			recipNorm = invSqrt(normS);
+			s0 *= recipNorm;
+			s1 *= recipNorm;
+			s2 *= recipNorm;
+			s3 *= recipNorm;
+
+			qDot1 -= ahrsConfig.beta * s0;
+			qDot2 -= ahrsConfig.beta * s1;
+			qDot3 -= ahrsConfig.beta * s2;
+			qDot4 -= ahrsConfig.beta * s3;
+		}
+	}
+
+	q0 += qDot1 * dt;
+	q1 += qDot2 * dt;
+	q2 += qDot3 * dt;
+	q3 += qDot4 * dt;
+}
+
+/*
+ * @brief ڼ 
+ * @note  ֱ ȣ, Ÿӽ  Ī ֱ ũ ٸ(ù ȣ,  ) Ī ֱ⸦ 
+ * @param acc: mpu6050Read(ACC)  3  
+ * @param gyro: mpu6050Read(GYRO)  3  
+ * @param timeUs:   ð, micros()
+ * @retval 
+ */
+void ahrsUpdate(const int16_t* acc, const int16_t* gyro, uint32_t timeUs) {
+	const uint32_t start = cycles();
+
+	float dt = ahrsDt;
+	if(!ahrsFirstUpdate) {
+		const float measured = (timeUs - ahrsLastTime) * 1e-6f;
+		if(measured > ahrsDt * AHRS_DT_MIN_RATIO && measured < ahrsDt * AHRS_DT_MAX_RATIO) {
+			dt = measured;
+		}
+	}
+	ahrsFirstUpdate = 0;
+	ahrsLastTime = timeUs;
+
+	const float gx = gyro[0] * AHRS_GYRO_SCALE;
+	const float gy = gyro[1] * AHRS_GYRO_SCALE;
+	const float gz = gyro[2] * AHRS_GYRO_SCALE;
+
+	switch(ahrsConfig.type) {
+	case AHRS_MAHONY:
+		ahrsMahonyUpdate(gx, gy, gz, acc[0], acc[1], acc[2], dt);
+		break;
+	case AHRS_MADGWICK:
+		ahrsMadgwickUpdate(gx, gy, gz, acc[0], acc[1], acc[2], dt);
+		break;
+	}
+
+	const float recipNorm = invSqrt(q0 * q0 + q1 * q1 + q2 * q2 + q3 * q3);
+	q0 *= recipNorm;
+	q1 *= recipNorm;
+	q2 *= recipNorm;
+	q3 *= recipNorm;
+
+	ahrsUpdateCycles = cycles() - start;
+}
+
+/*
+ * @brief ʹϾ б
+ * @param q: 4  ȯ  , w x y z 
+ * @retval 
+ */
+void ahrsGetQuaternion(float* q) {
+	q[0] = q0;
+	q[1] = q1;
+	q[2] = q2;
+	q[3] = q3;
+}
+
+/*
+ * @brief Ϸ б
+ * @param angle: 3  ȯ  , ahrsAngle_t , (degree)
+ * @retval 
+ */
+void ahrsGetEuler(float* angle) {
+	const float sinPitch = 2.0f * (q0 * q2 - q3 * q1);
+
+	angle[AHRS_ROLL] = atan2Approx(2.0f * (q0 * q1 + q2 * q3), 1.0f - 2.0f * (q1 * q1 + q2 * q2)) * RAD_TO_DEG_F;
+	angle[AHRS_PITCH] = asinApprox(sinPitch) * RAD_TO_DEG_F;
+	angle[AHRS_YAW] = atan2Approx(2.0f * (q0 * q3 + q1 * q2), 1.0f - 2.0f * (q2 * q2 + q3 * q3)) * RAD_TO_DEG_F;
+}
+
+/*
+ * @brief  ſ ɸ Ŭ  б
+ * @param 
+ * @retval Ŭ (uint32_t)
+ */
+uint32_t ahrsGetUpdateCycles(void) {
+	return ahrsUpdateCycles;
+}
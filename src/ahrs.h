@@ -0,0 +1,39 @@
+#ifndef _AHRS_H_
+#define _AHRS_H_
+
+/*
+ * @brief ڼ ˰ ü
+ */
+typedef enum {
+	AHRS_MAHONY = 0,
+	AHRS_MADGWICK,
+} ahrsType_t;
+
+/*
+ * @brief ڼ ʱȭ Ÿ ü
+ */
+typedef struct {
+	ahrsType_t type;
+	float sampleHz; // ahrsUpdate ȣǴ  ļ
+	float kp;       // mahony  
+	float ki;       // mahony  
+	float beta;     // madgwick 
+} ahrsInitTypeDef_t;
+
+/*
+ * @brief ڼ  ü, ahrsGetEuler  
+ */
+typedef enum {
+	AHRS_ROLL = 0,
+	AHRS_PITCH,
+	AHRS_YAW,
+} ahrsAngle_t;
+
+void ahrsStructInit(ahrsInitTypeDef_t* ahrsInitStruct);
+void ahrsInit(ahrsInitTypeDef_t* ahrsInitStruct);
+void ahrsUpdate(const int16_t* acc, const int16_t* gyro, uint32_t timeUs);
+void ahrsGetQuaternion(float* q);
+void ahrsGetEuler(float* angle);
+uint32_t ahrsGetUpdateCycles(void);
+
+#endif
@@ -0,0 +1,163 @@
+#ifndef _BOARD_H_
+#define _BOARD_H_
+
+#include <stm32f4xx.h>
+#include <stm32f4xx_conf.h>
+
+/*
+ * @brief  
+ * @note , AF, IRQ, Ŭ Ʈ  ⼭  Ÿ  , ϵ     ̹ .c ѹ 
+ * 		  ٸ  -DBOARD_HEADER="board_xxx.h"     Ǹ , ׸ ̸   ϰ ƾ
+ * 		  ׸ ش ϵ  ü ʵ   ߰ȣ  , C ̺ { } μ 
+ * 		  C++ Ļ(board.hpp) BOARD_FIELD ʵ ϳ   Ÿ  
+ */
+/*
+ * @brief ׸  n° ʵ , ڰ   Ѵܰ ħ
+ */
+#define BOARD_FIELD(n, ...) BOARD_FIELD_##n(__VA_ARGS__)
+#define BOARD_FIELD_0(a, ...) a
+#define BOARD_FIELD_1(a, b, ...) b
+#define BOARD_FIELD_2(a, b, c, ...) c
+#define BOARD_FIELD_3(a, b, c, d, ...) d
+#define BOARD_FIELD_4(a, b, c, d, e, ...) e
+#define BOARD_FIELD_5(a, b, c, d, e, f, ...) f
+#define BOARD_FIELD_6(a, b, c, d, e, f, g, ...) g
+#define BOARD_FIELD_7(a, b, c, d, e, f, g, h, ...) h
+#define BOARD_FIELD_8(a, b, c, d, e, f, g, h, i, ...) i
+#define BOARD_FIELD_9(a, b, c, d, e, f, g, h, i, j, ...) j
+#define BOARD_FIELD_10(a, b, c, d, e, f, g, h, i, j, k, ...) k
+
+#ifdef BOARD_HEADER
+#include BOARD_HEADER
+#else
+
+#define BOARD_NAME "STM32F405RGT6"
+
+/*
+ * @brief Ҷ  Ŭ (clock.h), HSE_VALUE  ũп 
+ */
+#define BOARD_CLOCK_PROFILE CLOCK_PROFILE_FULL
+
+/*
+ * @brief Ʈ: uart, gpio, tx, rx, irq, gpioClock, uartClock, gpioAF
+ * @note UART5   Ʈ  ʾƼ  ʱȭ Լδ ʱȭ Ұ
+ */
+#define BOARD_UART1 USART1, GPIOA, 9, 10, USART1_IRQn, RCC_AHB1Periph_GPIOA, RCC_APB2Periph_USART1, GPIO_AF_USART1
+//#define BOARD_UART1 USART1, GPIOB, 6, 7, USART1_IRQn, RCC_AHB1Periph_GPIOB, RCC_APB2Periph_USART1, GPIO_AF_USART1
+#define BOARD_UART2 USART2, GPIOA, 2, 3, USART2_IRQn, RCC_AHB1Periph_GPIOA, RCC_APB1Periph_USART2, GPIO_AF_USART2
+#define BOARD_UART3 USART3, GPIOC, 10, 11, USART3_IRQn, RCC_AHB1Periph_GPIOC, RCC_APB1Periph_USART3, GPIO_AF_USART3
+#define BOARD_UART4 UART4, GPIOA, 0, 1, UART4_IRQn, RCC_AHB1Periph_GPIOA, RCC_APB1Periph_UART4, GPIO_AF_UART4
+//#define BOARD_UART4 UART4, GPIOC, 10, 11, UART4_IRQn, RCC_AHB1Periph_GPIOC, RCC_APB1Periph_UART4, GPIO_AF_UART4
+#define BOARD_UART5 UART5, 0, 0, 0, 0, 0, 0, 0
+#define BOARD_UART6 USART6, GPIOC, 6, 7, USART6_IRQn, RCC_AHB1Periph_GPIOC, RCC_APB2Periph_USART6, GPIO_AF_USART6
+
+/*
+ * @brief Ʈ  DMA: rxStream, rxChannel, dmaClock
+ */
+#define BOARD_UART1_DMA DMA2_Stream2, DMA_Channel_4, RCC_AHB1Periph_DMA2
+#define BOARD_UART2_DMA DMA1_Stream5, DMA_Channel_4, RCC_AHB1Periph_DMA1
+#define BOARD_UART3_DMA DMA1_Stream1, DMA_Channel_4, RCC_AHB1Periph_DMA1
+#define BOARD_UART4_DMA DMA1_Stream2, DMA_Channel_4, RCC_AHB1Periph_DMA1
+#define BOARD_UART5_DMA DMA1_Stream0, DMA_Channel_4, RCC_AHB1Periph_DMA1
+#define BOARD_UART6_DMA DMA2_Stream1, DMA_Channel_5, RCC_AHB1Periph_DMA2
+
+/*
+ * @brief Ʈ ȣ  ȸ : gpio, pin, gpioClock, 0̸  
+ */
+#define BOARD_UART1_INVERTER 0, 0, 0
+#define BOARD_UART2_INVERTER 0, 0, 0
+#define BOARD_UART3_INVERTER 0, 0, 0
+#define BOARD_UART4_INVERTER 0, 0, 0
+#define BOARD_UART5_INVERTER 0, 0, 0
+#define BOARD_UART6_INVERTER 0, 0, 0
+
+/*
+ * @brief i2c: i2c, gpio, scl, sda, sclPinSource, sdaPinSource, gpioAF, evIrq, erIrq, gpioPeriph, i2cPeriph
+ */
+#define BOARD_I2C1 I2C1, GPIOB, GPIO_Pin_6, GPIO_Pin_7, GPIO_PinSource6, GPIO_PinSource7, GPIO_AF_I2C1, I2C1_EV_IRQn, I2C1_ER_IRQn, RCC_AHB1Periph_GPIOB, RCC_APB1Periph_I2C1
+#define BOARD_I2C2 I2C2, GPIOB, GPIO_Pin_10, GPIO_Pin_11, GPIO_PinSource10, GPIO_PinSource11, GPIO_AF_I2C2, I2C2_EV_IRQn, I2C2_ER_IRQn, RCC_AHB1Periph_GPIOB, RCC_APB1Periph_I2C2
+
+/*
+ * @brief ܺͷƮ: gpio, pin, portSource, pinSource, exti, irq, periph,  ʴ  gpio NULL
+ */
+#define BOARD_EXTI0  NULL, GPIO_Pin_0, 0xff, EXTI_PinSource0, EXTI_Line0, EXTI0_IRQn, 0xff
+#define BOARD_EXTI1  NULL, GPIO_Pin_1, 0xff, EXTI_PinSource1, EXTI_Line1, EXTI1_IRQn, 0xff
+#define BOARD_EXTI2  GPIOD, GPIO_Pin_2, EXTI_PortSourceGPIOD, EXTI_PinSource2, EXTI_Line2, EXTI2_IRQn, RCC_AHB1Periph_GPIOD
+#define BOARD_EXTI3  GPIOC, GPIO_Pin_3, EXTI_PortSourceGPIOC, EXTI_PinSource3, EXTI_Line3, EXTI3_IRQn, RCC_AHB1Periph_GPIOC
+#define BOARD_EXTI4  GPIOA, GPIO_Pin_4, EXTI_PortSourceGPIOA, EXTI_PinSource4, EXTI_Line4, EXTI4_IRQn, RCC_AHB1Periph_GPIOA
+#define BOARD_EXTI5  GPIOA, GPIO_Pin_5, EXTI_PortSourceGPIOA, EXTI_PinSource5, EXTI_Line5, EXTI9_5_IRQn, RCC_AHB1Periph_GPIOA
+#define BOARD_EXTI6  NULL, GPIO_Pin_6, 0xff, EXTI_PinSource6, EXTI_Line6, EXTI9_5_IRQn, 0xff
+#define BOARD_EXTI7  NULL, GPIO_Pin_7, 0xff, EXTI_PinSource7, EXTI_Line7, EXTI9_5_IRQn, 0xff
+#define BOARD_EXTI8  NULL, GPIO_Pin_8, 0xff, EXTI_PinSource8, EXTI_Line8, EXTI9_5_IRQn, 0xff
+#define BOARD_EXTI9  NULL, GPIO_Pin_9, 0xff, EXTI_PinSource9, EXTI_Line9, EXTI9_5_IRQn, 0xff
+#define BOARD_EXTI10 NULL, GPIO_Pin_10, 0xff, EXTI_PinSource10, EXTI_Line10, EXTI15_10_IRQn, 0xff
+#define BOARD_EXTI11 NULL, GPIO_Pin_11, 0xff, EXTI_PinSource11, EXTI_Line11, EXTI15_10_IRQn, 0xff
+#define BOARD_EXTI12 GPIOC, GPIO_Pin_12, EXTI_PortSourceGPIOC, EXTI_PinSource12, EXTI_Line12, EXTI15_10_IRQn, RCC_AHB1Periph_GPIOC
+#define BOARD_EXTI13 NULL, GPIO_Pin_13, 0xff, EXTI_PinSource13, EXTI_Line13, EXTI15_10_IRQn, 0xff
+#define BOARD_EXTI14 NULL, GPIO_Pin_14, 0xff, EXTI_PinSource14, EXTI_Line14, EXTI15_10_IRQn, 0xff
+#define BOARD_EXTI15 GPIOB, GPIO_Pin_15, EXTI_PortSourceGPIOB, EXTI_PinSource15, EXTI_Line15, EXTI15_10_IRQn, RCC_AHB1Periph_GPIOB
+
+/*
+ * @brief Ÿ̸ Էĸó ä: tim, gpio, pin, pinSource, channel, irq, gpioClock, timClock, gpioAF
+ */
+#define BOARD_TIMER1 TIM3, GPIOB, GPIO_Pin_4, GPIO_PinSource4, TIM_Channel_1, TIM3_IRQn, RCC_AHB1Periph_GPIOB, RCC_APB1Periph_TIM3, GPIO_AF_TIM3
+#define BOARD_TIMER2 TIM3, GPIOB, GPIO_Pin_5, GPIO_PinSource5, TIM_Channel_2, TIM3_IRQn, RCC_AHB1Periph_GPIOB, RCC_APB1Periph_TIM3, GPIO_AF_TIM3
+#define BOARD_TIMER3 TIM3, GPIOB, GPIO_Pin_0, GPIO_PinSource0, TIM_Channel_3, TIM3_IRQn, RCC_AHB1Periph_GPIOB, RCC_APB1Periph_TIM3, GPIO_AF_TIM3
+#define BOARD_TIMER4 TIM3, GPIOB, GPIO_Pin_1, GPIO_PinSource1, TIM_Channel_4, TIM3_IRQn, RCC_AHB1Periph_GPIOB, RCC_APB1Periph_TIM3, GPIO_AF_TIM3
+#define BOARD_TIMER5 TIM12, GPIOB, GPIO_Pin_14, GPIO_PinSource14, TIM_Channel_1, TIM8_BRK_TIM12_IRQn, RCC_AHB1Periph_GPIOB, RCC_APB1Periph_TIM12, GPIO_AF_TIM12
+#define BOARD_TIMER6 TIM12, GPIOB, GPIO_Pin_15, GPIO_PinSource15, TIM_Channel_2, TIM8_BRK_TIM12_IRQn, RCC_AHB1Periph_GPIOB, RCC_APB1Periph_TIM12, GPIO_AF_TIM12
+
+/*
+ * @brief  : tim, gpio, pin, pinSource, channel, gpioClock, timClock, gpioAF,
+ * 		  dmaStream, dmaChannel, dmaFlag, dmaClock, dmaIrq, captureDmaStream, captureDmaChannel, captureDmaFlag
+ * @note TIM1_UP DMA2 Stream5 Channel6, PA9, PA10 USART1, PA11 USB ġǷ   
+ * 		  ĸó DMA TIM1_CH1 Stream3, CH2 Stream2(USART1 RX ħ), CH3 Stream6, CH4 Stream4,  Channel6
+ */
+#define BOARD_DMA_FLAG_ALL(n) (DMA_FLAG_TCIF##n | DMA_FLAG_HTIF##n | DMA_FLAG_TEIF##n | DMA_FLAG_DMEIF##n | DMA_FLAG_FEIF##n)
+#define BOARD_MOTOR1 TIM1, GPIOA, GPIO_Pin_8, GPIO_PinSource8, TIM_Channel_1, RCC_AHB1Periph_GPIOA, RCC_APB2Periph_TIM1, GPIO_AF_TIM1, \
+	DMA2_Stream5, DMA_Channel_6, BOARD_DMA_FLAG_ALL(5), RCC_AHB1Periph_DMA2, DMA2_Stream5_IRQn, DMA2_Stream3, DMA_Channel_6, BOARD_DMA_FLAG_ALL(3)
+#define BOARD_MOTOR2 TIM1, GPIOA, GPIO_Pin_9, GPIO_PinSource9, TIM_Channel_2, RCC_AHB1Periph_GPIOA, RCC_APB2Periph_TIM1, GPIO_AF_TIM1, \
+	DMA2_Stream5, DMA_Channel_6, BOARD_DMA_FLAG_ALL(5), RCC_AHB1Periph_DMA2, DMA2_Stream5_IRQn, DMA2_Stream2, DMA_Channel_6, BOARD_DMA_FLAG_ALL(2)
+#define BOARD_MOTOR3 TIM1, GPIOA, GPIO_Pin_10, GPIO_PinSource10, TIM_Channel_3, RCC_AHB1Periph_GPIOA, RCC_APB2Periph_TIM1, GPIO_AF_TIM1, \
+	DMA2_Stream5, DMA_Channel_6, BOARD_DMA_FLAG_ALL(5), RCC_AHB1Periph_DMA2, DMA2_Stream5_IRQn, DMA2_Stream6, DMA_Channel_6, BOARD_DMA_FLAG_ALL(6)
+#define BOARD_MOTOR4 TIM1, GPIOA, GPIO_Pin_11, GPIO_PinSource11, TIM_Channel_4, RCC_AHB1Periph_GPIOA, RCC_APB2Periph_TIM1, GPIO_AF_TIM1, \
+	DMA2_Stream5, DMA_Channel_6, BOARD_DMA_FLAG_ALL(5), RCC_AHB1Periph_DMA2, DMA2_Stream5_IRQn, DMA2_Stream4, DMA_Channel_6, BOARD_DMA_FLAG_ALL(4)
+
+/*
+ * @brief DShot Ʈ DMA ۿϷ ͷƮ, Ͱ  dmaStream ϳ: stream, ͷƮ ÷׿ ڵ鷯 ̸
+ * @note  DShot  ͷƮ Էĸó ٲٹǷ   stream  Ÿ̸Ӵ dshotInit 
+ * 		  ι°  Ÿ̸Ӹ  BOARD_DSHOT_DMA2_IRQHandler, BOARD_DSHOT_DMA2 
+ */
+#define BOARD_DSHOT_DMA1_IRQHandler DMA2_Stream5_IRQHandler
+#define BOARD_DSHOT_DMA1 DMA2_Stream5, DMA_IT_TCIF5
+
+/*
+ * @brief ű ä ġ, ġ ȣ (THR, AIL, ELE, RUD, AUX1 ), 0xff 
+ */
+#define BOARD_PWM1_EXTI  { EXTI_DEVICE_2, EXTI_DEVICE_3, EXTI_DEVICE_4, EXTI_DEVICE_5, EXTI_DEVICE_15, 0xff }
+#define BOARD_PWM2_EXTI  { EXTI_DEVICE_12, EXTI_DEVICE_3, EXTI_DEVICE_4, EXTI_DEVICE_5, EXTI_DEVICE_15, 0xff }
+#define BOARD_PWM1_TIMER { TIMER_DEVICE_1, TIMER_DEVICE_2, TIMER_DEVICE_3, TIMER_DEVICE_4, TIMER_DEVICE_6, 0xff }
+#define BOARD_PWM2_TIMER { TIMER_DEVICE_5, TIMER_DEVICE_2, TIMER_DEVICE_3, TIMER_DEVICE_4, TIMER_DEVICE_6, 0xff }
+
+/*
+ * @brief ø ű Ʈ, ű ġ ü 
+ */
+#define BOARD_SERIALRX1 UART_DEVICE_2
+#define BOARD_SERIALRX2 UART_DEVICE_4
+
+/*
+ * @brief ٷ  Ÿ̸: tim, irq, timClock ͷƮ ڵ鷯 ̸
+ * @note   ⺻ Ÿ̸, ٸ Ÿ̸ӷ ٲٸ irq ڵ鷯 ̸  ٲܰ
+ */
+#define BOARD_SCHEDULER_TIMER TIM7, TIM7_IRQn, RCC_APB1Periph_TIM7
+#define BOARD_SCHEDULER_IRQHandler TIM7_IRQHandler
+
+/*
+ * @brief   ÷: address1, address2, size, sector1, sector2
+ * @note ڵ尡  ʴ   128KB , ڵ尡 768KB  Ŀ ũƮ FLASH ̸ ϰ
+ */
+#define BOARD_CONFIG_FLASH 0x080C0000, 0x080E0000, 0x20000, FLASH_Sector_10, FLASH_Sector_11
+
+#endif
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef _BOARD_HPP_
+#define _BOARD_HPP_
+
+#ifndef __cplusplus
+#error "board.hpp C++ , C board.h "
+#endif
+
+#include <stdint.h>
+#include <stm32f4xx.h>
+#include <stm32f4xx_conf.h>
+
+/*
+ * @brief C  bool typedef(uint8_t) C++ bool ε ʵ 
+ * @note   1Ʈ, 0/1̹Ƿ C Լ ְ޾Ƶ 
+ */
+#ifndef bool
+#define bool bool
+#endif
+
+extern "C" {
+#include <board.h>
+#include <drv_uart.h>
+#include <drv_i2c.h>
+}
+
+/*
+ * @brief  Ǹ ġ  Ÿ 
+ * @note  ʵ constexpr,  ʹ ζ Լ ȣϸ ּ  
+ * 		  valid false ġ(忡  ִ ׸)  Ļ static_assert  
+ */
+template<uartDevice_t D> struct UartBoard;
+template<i2cDevice_t D> struct I2cBoard;
+
+#define BOARD_UART_TRAITS(dev, ...) \
+template<> struct UartBoard<dev> { \
+	static USART_TypeDef* uart() { return BOARD_FIELD(0, __VA_ARGS__); } \
+	static GPIO_TypeDef* gpio() { return BOARD_FIELD(1, __VA_ARGS__); } \
+	static constexpr uint8_t txPin = BOARD_FIELD(2, __VA_ARGS__); \
+	static constexpr uint8_t rxPin = BOARD_FIELD(3, __VA_ARGS__); \
+	static constexpr uint8_t irq = BOARD_FIELD(4, __VA_ARGS__); \
+	static constexpr uint32_t gpioClock = BOARD_FIELD(5, __VA_ARGS__); \
+	static constexpr uint32_t uartClock = BOARD_FIELD(6, __VA_ARGS__); \
+	static constexpr uint8_t gpioAF = BOARD_FIELD(7, __VA_ARGS__); \
+	static constexpr bool valid = (BOARD_FIELD(5, __VA_ARGS__) != 0); \
+};
+
+BOARD_UART_TRAITS(UART_DEVICE_1, BOARD_UART1)
+BOARD_UART_TRAITS(UART_DEVICE_2, BOARD_UART2)
+BOARD_UART_TRAITS(UART_DEVICE_3, BOARD_UART3)
+BOARD_UART_TRAITS(UART_DEVICE_4, BOARD_UART4)
+BOARD_UART_TRAITS(UART_DEVICE_5, BOARD_UART5)
+BOARD_UART_TRAITS(UART_DEVICE_6, BOARD_UART6)
+
+#define BOARD_I2C_TRAITS(dev, ...) \
+template<> struct I2cBoard<dev> { \
+	static I2C_TypeDef* i2c() { return BOARD_FIELD(0, __VA_ARGS__); } \
+	static GPIO_TypeDef* gpio() { return BOARD_FIELD(1, __VA_ARGS__); } \
+	static constexpr uint16_t scl = BOARD_FIELD(2, __VA_ARGS__); \
+	static constexpr uint16_t sda = BOARD_FIELD(3, __VA_ARGS__); \
+	static constexpr uint8_t sclPinSource = BOARD_FIELD(4, __VA_ARGS__); \
+	static constexpr uint8_t sdaPinSource = BOARD_FIELD(5, __VA_ARGS__); \
+	static constexpr uint8_t gpioAF = BOARD_FIELD(6, __VA_ARGS__); \
+	static constexpr uint8_t evIrq = BOARD_FIELD(7, __VA_ARGS__); \
+	static constexpr uint8_t erIrq = BOARD_FIELD(8, __VA_ARGS__); \
+	static constexpr uint32_t gpioPeriph = BOARD_FIELD(9, __VA_ARGS__); \
+	static constexpr uint32_t i2cPeriph = BOARD_FIELD(10, __VA_ARGS__); \
+	static constexpr bool valid = (BOARD_FIELD(9, __VA_ARGS__) != 0); \
+};
+
+BOARD_I2C_TRAITS(I2C_DEVICE_1, BOARD_I2C1)
+BOARD_I2C_TRAITS(I2C_DEVICE_2, BOARD_I2C2)
+
+#endif
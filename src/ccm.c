@@ -0,0 +1,33 @@
+#include <stm32f4xx.h>
+#include <stm32f4xx_conf.h>
+#include <ccm.h>
+
+#if CCM_ENABLE
+/*
+ * @brief Ŀ ũƮ(ccm.ld) ϴ CCM  
+ */
+extern uint32_t _siccmdata, _sccmdata, _eccmdata;
+extern uint32_t _sccmbss, _eccmbss;
+#endif
+
+/*
+ * @brief CCM ʱȭ
+ * @note CCM   ٸ ʱȭ  ȣؾ, systemInit   ȣ
+ * 		  startup ڵ SRAM .data, .bss ʱȭϹǷ CCM  ⼭ ä, CCM_ENABLE 0̸   
+ * @param 
+ * @retval 
+ */
+void ccmInit(void) {
+#if CCM_ENABLE
+	RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_CCMDATARAMEN, ENABLE);
+
+	const uint32_t* src = &_siccmdata;
+	uint32_t* dst;
+	for(dst = &_sccmdata; dst < &_eccmdata; dst++) {
+		*dst = *src++;
+	}
+	for(dst = &_sccmbss; dst < &_eccmbss; dst++) {
+		*dst = 0;
+	}
+#endif
+}
@@ -0,0 +1,38 @@
+#ifndef _CCM_H_
+#define _CCM_H_
+
+#include <stm32f4xx.h>
+
+/*
+ * @brief CCM(core coupled memory) , 64KB
+ * @note D  Ǿ   , DMA CCM   
+ * 		  CPU   ϴ ͸ ű DMA  Ʈ  
+ */
+#define CCM_BASE_ADDRESS 0x10000000UL
+#define CCM_SIZE         0x10000UL
+
+/*
+ * @brief CCM  , 1 ϸ CCM_BSS/CCM_DATA  CCM 
+ * @note  Ŀ ũƮ ccm.ld INCLUDEؾϰ, ũ  tools/sizereport.py ݵ Ұ(DMA ۰ CCM  )
+ * 		  0̸ Ӽ ƹ͵ ƴϰ ccmInit   ,   .bss/.data 
+ */
+#ifndef CCM_ENABLE
+#define CCM_ENABLE 0
+#endif
+
+/*
+ * @brief CCM   Ӽ
+ * @note CCM_BSS ccmInit 0 ä, ʱⰪ ִ  CCM_DATA ϸ ÷ÿ 
+ * 		  !, DMA ϴ ۿ DMA ѱ () CCM θ ȵ
+ */
+#if CCM_ENABLE
+#define CCM_BSS  __attribute__((section(".ccmbss")))
+#define CCM_DATA __attribute__((section(".ccmdata")))
+#else
+#define CCM_BSS
+#define CCM_DATA
+#endif
+
+void ccmInit(void);
+
+#endif
@@ -0,0 +1,151 @@
+#include <stm32f4xx.h>
+#include <stm32f4xx_conf.h>
+#include <clock.h>
+#include <system.h>
+#include <drv_uart.h>
+#include <drv_i2c.h>
+#include <drv_timer.h>
+#include <scheduler.h>
+
+/*
+ * @brief ̸  
+ * @note FULL: 168MHz, APB1 42MHz, APB2 84MHz, LOW: 48MHz, APB1 24MHz, APB2 48MHz
+ */
+const clockConfig_t clockProfiles[CLOCK_PROFILE_MAX] = {
+	{ RCC_PLLSource_HSE, HSE_VALUE / 1000000, 336, 2, 7, 1, 4, 2 },
+	{ RCC_PLLSource_HSE, HSE_VALUE / 1000000, 192, 4, 4, 1, 2, 1 },
+};
+
+/*
+ * @brief AHB ֺ  
+ * @retval RCC_SYSCLK_Divx,  ֺ 0xffffffff
+ */
+static uint32_t clockAhbDiv(uint16_t div) {
+	switch(div) {
+	case 1: return RCC_SYSCLK_Div1;
+	case 2: return RCC_SYSCLK_Div2;
+	case 4: return RCC_SYSCLK_Div4;
+	case 8: return RCC_SYSCLK_Div8;
+	case 16: return RCC_SYSCLK_Div16;
+	case 64: return RCC_SYSCLK_Div64;
+	case 128: return RCC_SYSCLK_Div128;
+	case 256: return RCC_SYSCLK_Div256;
+	case 512: return RCC_SYSCLK_Div512;
+	}
+	return 0xffffffff;
+}
+
+/*
+ * @brief APB ֺ  
+ * @retval RCC_HCLK_Divx,  ֺ 0xffffffff
+ */
+static uint32_t clockApbDiv(uint8_t div) {
+	switch(div) {
+	case 1: return RCC_HCLK_Div1;
+	case 2: return RCC_HCLK_Div2;
+	case 4: return RCC_HCLK_Div4;
+	case 8: return RCC_HCLK_Div8;
+	case 16: return RCC_HCLK_Div16;
+	}
+	return 0xffffffff;
+}
+
+/*
+ * @brief   HCLK 
+ * @param config: Ŭ  ü 
+ * @retval HCLK(Hz),   ̸ 0
+ */
+uint32_t clockGetHclk(const clockConfig_t* config) {
+	const uint32_t source = (config->pllSource == RCC_PLLSource_HSE) ? HSE_VALUE : HSI_VALUE;
+	if(config->pllM < 2 || config->pllM > 63 || config->pllP < 2 || config->pllP > 8 || (config->pllP & 1)
+			|| config->pllQ < 2 || config->pllQ > 15) {
+		return 0;
+	}
+	const uint32_t vcoIn = source / config->pllM;
+	const uint32_t vco = vcoIn * config->pllN;
+	if(vcoIn < 1000000 || vcoIn > 2000000 || vco < 192000000 || vco > 432000000) {
+		return 0;
+	}
+	const uint32_t sysclk = vco / config->pllP;
+	if(sysclk > CLOCK_SYSCLK_MAX || clockAhbDiv(config->ahbDiv) == 0xffffffff
+			|| clockApbDiv(config->apb1Div) == 0xffffffff || clockApbDiv(config->apb2Div) == 0xffffffff) {
+		return 0;
+	}
+	const uint32_t hclk = sysclk / config->ahbDiv;
+	if(hclk / config->apb1Div > CLOCK_PCLK1_MAX || hclk / config->apb2Div > CLOCK_PCLK2_MAX) {
+		return 0;
+	}
+	return hclk;
+}
+
+/*
+ * @brief ÷  
+ */
+static uint32_t clockFlashLatency(uint32_t hclk) {
+	return (hclk - 1) / CLOCK_FLASH_WS_HZ;
+}
+
+/*
+ * @brief Ŭ 
+ * @note PLL ٲٴ  HSI ,  ÷ ¸  ø  ߿ 
+ * 		  ٲ  micros() ̾ ð  ű SysTick, Ʈ Ʈ, i2c Ÿ̹, Էĸó ֺ ٽ 
+ * 		  dshot, pwmout  ٽ ʱȭؾ, Ͱ  ٲ 
+ * 		  i2c ߿ θ ȵ
+ * @param config: Ŭ  ü 
+ * @retval   ų HSE   ERROR, ̶ Ŭ ٲ 
+ */
+ErrorStatus clockConfigure(const clockConfig_t* config) {
+	const uint32_t hclk = clockGetHclk(config);
+	if(hclk == 0) {
+		return ERROR;
+	}
+	if(config->pllSource == RCC_PLLSource_HSE) {
+		RCC_HSEConfig(RCC_HSE_ON);
+		if(RCC_WaitForHSEStartUp() == ERROR) {
+			return ERROR;
+		}
+	}
+	const uint32_t latency = clockFlashLatency(hclk);
+
+	// PLL ٲٴ  HSI
+	RCC_HSICmd(ENABLE);
+	while(RCC_GetFlagStatus(RCC_FLAG_HSIRDY) == RESET);
+	if((FLASH->ACR & FLASH_ACR_LATENCY) < latency) {
+		FLASH_SetLatency(latency);
+	}
+	RCC_SYSCLKConfig(RCC_SYSCLKSource_HSI);
+	while(RCC_GetSYSCLKSource() != 0x00);
+	RCC_HCLKConfig(RCC_SYSCLK_Div1);
+	setSystemClock(HSI_VALUE);
+
+	RCC_PLLCmd(DISABLE);
+	RCC_APB1PeriphClockCmd(RCC_APB1Periph_PWR, ENABLE);
+	PWR_MainRegulatorModeConfig((hclk > CLOCK_SCALE2_MAX) ? PWR_Regulator_Voltage_Scale1 : PWR_Regulator_Voltage_Scale2);
+	RCC_PLLConfig(config->pllSource, config->pllM, config->pllN, config->pllP, config->pllQ);
+	RCC_PLLCmd(ENABLE);
+	while(RCC_GetFlagStatus(RCC_FLAG_PLLRDY) == RESET);
+
+	RCC_PCLK1Config(clockApbDiv(config->apb1Div));
+	RCC_PCLK2Config(clockApbDiv(config->apb2Div));
+	RCC_HCLKConfig(clockAhbDiv(config->ahbDiv));
+	RCC_SYSCLKConfig(RCC_SYSCLKSource_PLLCLK);
+	while(RCC_GetSYSCLKSource() != 0x08);
+	FLASH_SetLatency(latency);
+
+	SystemCoreClockUpdate();
+	setSystemClock(hclk);
+	uartClockUpdate();
+	i2cClockUpdate();
+	timerClockUpdate();
+	schedulerClockUpdate();
+	return SUCCESS;
+}
+
+/*
+ * @brief ̸  Ϸ Ŭ 
+ * @param profile: Ŭ  ü
+ * @retval error
+ */
+ErrorStatus clockSetProfile(clockProfile_t profile) {
+	return clockConfigure(&clockProfiles[profile]);
+}
@@ -0,0 +1,47 @@
+#ifndef _CLOCK_H_
+#define _CLOCK_H_
+
+#include <stm32f4xx.h>
+#include <board.h>
+
+#define CLOCK_SYSCLK_MAX   168000000
+#define CLOCK_PCLK1_MAX    42000000
+#define CLOCK_PCLK2_MAX    84000000
+#define CLOCK_SCALE2_MAX   144000000 // ̸ ַ Scale2  
+#define CLOCK_FLASH_WS_HZ  30000000  // 2.7 ~ 3.6V  ϳ Ŭ
+
+/*
+ * @brief Ŭ  ü
+ */
+typedef enum {
+	CLOCK_PROFILE_FULL = 0, // 168MHz
+	CLOCK_PROFILE_LOW,      // 48MHz, USB Ŭ 
+	CLOCK_PROFILE_MAX,
+} clockProfile_t;
+
+/*
+ * @brief Ŭ  ü
+ * @note SYSCLK =  / pllM * pllN / pllP, USB =  / pllM * pllN / pllQ
+ * 		  ֺ   ƴ (1, 2, 4, ...)
+ */
+typedef struct {
+	uint32_t pllSource; // RCC_PLLSource_HSE, RCC_PLLSource_HSI
+	uint16_t pllM;      // VCO Է 1 ~ 2MHz ǵ
+	uint16_t pllN;      // VCO  192 ~ 432MHz
+	uint8_t pllP;       // 2, 4, 6, 8
+	uint8_t pllQ;       // USB  48MHz ǵ
+	uint16_t ahbDiv;    // 1, 2, 4, 8, 16, 64, 128, 256, 512
+	uint8_t apb1Div;    // 1, 2, 4, 8, 16, PCLK1 42MHz 
+	uint8_t apb2Div;    // 1, 2, 4, 8, 16, PCLK2 84MHz 
+} clockConfig_t;
+
+/*
+ * @brief ̸  , HSE_VALUE 
+ */
+extern const clockConfig_t clockProfiles[CLOCK_PROFILE_MAX];
+
+ErrorStatus clockConfigure(const clockConfig_t* config);
+ErrorStatus clockSetProfile(clockProfile_t profile);
+uint32_t clockGetHclk(const clockConfig_t* config);
+
+#endif
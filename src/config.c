@@ -0,0 +1,290 @@
+#include <stm32f4xx.h>
+#include <stm32f4xx_conf.h>
+#include <string.h>
+#include <config.h>
+
+/*
+ * @brief  
+ * @note  Ӹ: magic, generation  , magic  Ἥ  ű ͸ ȿ
+ * 		  ڵ: key(16) | len(16)  , (4Ʈ  ä), CRC32  
+ * 		   Ű ٽ  ڿ ̰  ڵ尡 ȿ, Ͱ  ٸ ͷ ֽŰ ű()
+ * 		   ͸  Ƿ  Ƚ ,      Ͱ 
+ */
+#define CONFIG_HEADER_SIZE  8
+#define CONFIG_ALIGN(len)   (((uint32_t)(len) + 3) & ~3UL)
+#define CONFIG_RECORD_SIZE(len) (4 + CONFIG_ALIGN(len) + 4)
+#define CONFIG_ERASED       0xffffffff
+
+/*
+ * @brief  ÷  ȣ, ּҿ Բ board.h
+ */
+static const uint16_t configFlashSector[2] = { BOARD_FIELD(3, BOARD_CONFIG_FLASH), BOARD_FIELD(4, BOARD_CONFIG_FLASH) };
+
+static bool configFlashErase(uint8_t index);
+static bool configFlashProgram(const uint8_t* address, uint32_t data);
+
+const configFlash_t configFlashInternal = {
+	{ (const uint8_t*)BOARD_FIELD(0, BOARD_CONFIG_FLASH), (const uint8_t*)BOARD_FIELD(1, BOARD_CONFIG_FLASH) },
+	BOARD_FIELD(2, BOARD_CONFIG_FLASH),
+	configFlashErase,
+	configFlashProgram,
+};
+
+/*
+ * @brief  ÷ÿ 
+ */
+static const configFlash_t* configFlash = NULL;
+static uint8_t configActive = 0;
+static uint32_t configGeneration = 0;
+static uint32_t configUsed = 0; //  ڵ带  ġ( ۺ)
+static uint16_t configBadRecords = 0;
+
+/*
+ * @brief Ű ֽ ڵ, ÷ø  Ŵ
+ */
+static struct {
+	const uint8_t* data;
+	uint16_t len;
+} configIndex[CONFIG_KEY_MAX];
+
+/*
+ * @brief CRC32(0xedb88320), Ϻ ̺
+ */
+static const uint32_t configCrcTable[16] = {
+	0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+	0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c, 0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c,
+};
+
+static uint32_t configCrc(uint32_t crc, const uint8_t* data, uint32_t len) {
+	while(len--) {
+		crc ^= *data++;
+		crc = (crc >> 4) ^ configCrcTable[crc & 0x0f];
+		crc = (crc >> 4) ^ configCrcTable[crc & 0x0f];
+	}
+	return crc;
+}
+
+static inline uint32_t configWord(const uint8_t* p) {
+	return *(const uint32_t*)p;
+}
+
+/*
+ * @brief  ÷  
+ * @note 128KB ʹ 1 ̻ ɸ ׵ ÷ÿ ڵ带   CPU , Ҷ 
+ */
+static bool configFlashErase(uint8_t index) {
+	FLASH_Unlock();
+	FLASH_ClearFlag(FLASH_FLAG_EOP | FLASH_FLAG_OPERR | FLASH_FLAG_WRPERR | FLASH_FLAG_PGAERR | FLASH_FLAG_PGPERR | FLASH_FLAG_PGSERR);
+	const bool ok = (FLASH_EraseSector(configFlashSector[index], VoltageRange_3) == FLASH_COMPLETE);
+	FLASH_Lock();
+	return ok;
+}
+
+static bool configFlashProgram(const uint8_t* address, uint32_t data) {
+	FLASH_Unlock();
+	const bool ok = (FLASH_ProgramWord((uint32_t)(uintptr_t)address, data) == FLASH_COMPLETE);
+	FLASH_Lock();
+	return ok;
+}
+
+/*
+ * @brief  Ӹ ȿ Ȯ
+ */
+static bool configSectorValid(uint8_t index) {
+	return configWord(configFlash->base[index]) == CONFIG_MAGIC;
+}
+
+/*
+ * @brief ڵ ϳ 
+ * @note Ӹ, , CRC  , ߰   CRC Ʋ  ǳʶ
+ * @param index:  ȣ
+ * @param offset:  ȿ  ġ
+ * @retval ϸ true
+ */
+static bool configWriteRecord(uint8_t index, uint32_t offset, configKey_t key, const uint8_t* data, uint16_t len) {
+	const uint8_t* p = configFlash->base[index] + offset;
+	const uint32_t header = (uint32_t)key | ((uint32_t)len << 16);
+	uint32_t crc = configCrc(0xffffffff, (const uint8_t*)&header, 4);
+	bool ok = configFlash->program(p, header);
+	p += 4;
+
+	uint32_t i;
+	for(i = 0; i < len; i += 4) {
+		uint32_t word = CONFIG_ERASED;
+		const uint32_t n = (len - i < 4) ? (len - i) : 4;
+		memcpy(&word, data + i, n);
+		crc = configCrc(crc, (const uint8_t*)&word, 4);
+		ok = ok && configFlash->program(p, word);
+		p += 4;
+	}
+	return ok && configFlash->program(p, ~crc);
+}
+
+/*
+ * @brief ͸ Ⱦ Ű ֽ ڵ带 ã
+ * @note   ʰ ÷ ּҸ 
+ * @param index:  ȣ
+ * @retval 
+ */
+static void configScan(uint8_t index) {
+	const uint8_t* base = configFlash->base[index];
+	uint32_t offset = CONFIG_HEADER_SIZE;
+	uint8_t i;
+
+	for(i = 0; i < CONFIG_KEY_MAX; i++) {
+		configIndex[i].data = NULL;
+		configIndex[i].len = 0;
+	}
+	configBadRecords = 0;
+
+	while(offset + 8 <= configFlash->size) {
+		const uint32_t header = configWord(base + offset);
+		if(header == CONFIG_ERASED) {
+			break; //  
+		}
+		const uint16_t key = header & 0xffff;
+		const uint16_t len = header >> 16;
+		const uint32_t size = CONFIG_RECORD_SIZE(len);
+		if(len > CONFIG_VALUE_MAX || offset + size > configFlash->size) {
+			// Ӹ   ڵ带 ã  ,  ⿡ ϵ ͸  
+			configBadRecords++;
+			offset = configFlash->size;
+			break;
+		}
+		const uint32_t crc = configCrc(0xffffffff, base + offset, 4 + CONFIG_ALIGN(len));
+		if(~crc != configWord(base + offset + size - 4)) {
+			configBadRecords++;
+		}
+		else if(key < CONFIG_KEY_MAX) {
+			configIndex[key].data = base + offset + 4;
+			configIndex[key].len = len;
+		}
+		offset += size;
+	}
+	configActive = index;
+	configGeneration = configWord(base + 4);
+	configUsed = offset;
+}
+
+/*
+ * @brief ٸ ͸  ֽŰ ű
+ * @note   Ű   ű,       
+ * @param 
+ * @retval ϸ true
+ */
+static bool configCompact(void) {
+	const uint8_t target = configActive ^ 1;
+	const uint8_t* base = configFlash->base[target];
+	uint32_t offset = CONFIG_HEADER_SIZE;
+	uint8_t i;
+
+	if(configFlash->erase(target) == false) {
+		return false;
+	}
+	for(i = 0; i < CONFIG_KEY_MAX; i++) {
+		if(configIndex[i].data == NULL) {
+			continue;
+		}
+		if(configWriteRecord(target, offset, (configKey_t)i, configIndex[i].data, configIndex[i].len) == false) {
+			return false;
+		}
+		offset += CONFIG_RECORD_SIZE(configIndex[i].len);
+	}
+	//  ű  Ӹ , magic 
+	if(configFlash->program(base + 4, configGeneration + 1) == false || configFlash->program(base, CONFIG_MAGIC) == false) {
+		return false;
+	}
+	configScan(target);
+	return true;
+}
+
+/*
+ * @brief   ʱȭ
+ * @note ȿ   generation ū  Ⱦ ϸ ,   
+ * 		    ȿ (ó ) 0 ͸   Ҹ 
+ * @param flash: ÷ 鿣,  &configFlashInternal
+ * @retval error
+ */
+ErrorStatus configInit(const configFlash_t* flash) {
+	configFlash = flash;
+	const bool valid0 = configSectorValid(0);
+	const bool valid1 = configSectorValid(1);
+
+	if(valid0 && valid1) {
+		//    ͸  ̸   ȿ,  ؼ ħ 
+		const int32_t diff = (int32_t)(configWord(flash->base[1] + 4) - configWord(flash->base[0] + 4));
+		configScan(diff > 0 ? 1 : 0);
+	}
+	else if(valid0 || valid1) {
+		configScan(valid1 ? 1 : 0);
+	}
+	else {
+		if(flash->erase(0) == false || flash->program(flash->base[0] + 4, 0) == false || flash->program(flash->base[0], CONFIG_MAGIC) == false) {
+			return ERROR;
+		}
+		configScan(0);
+	}
+	return SUCCESS;
+}
+
+/*
+ * @brief  б
+ * @note ÷ø  Ű ͸ ֹǷ   , configSet ڿ ٽ 
+ * @param key:  Ű
+ * @param len:  Ʈ   , ʿ NULL
+ * @retval  ,    NULL
+ */
+const void* configGet(configKey_t key, uint16_t* len) {
+	if(configFlash == NULL || key >= CONFIG_KEY_MAX || configIndex[key].data == NULL) {
+		return NULL;
+	}
+	if(len != NULL) {
+		*len = configIndex[key].len;
+	}
+	return configIndex[key].data;
+}
+
+/*
+ * @brief  
+ * @note     , Ͱ  ϹǷ  ɸ  ( ȣ )
+ * @param key:  Ű
+ * @param data:  
+ * @param len:  Ʈ , CONFIG_VALUE_MAX 
+ * @retval error
+ */
+ErrorStatus configSet(configKey_t key, const void* data, uint16_t len) {
+	if(configFlash == NULL || key >= CONFIG_KEY_MAX || len > CONFIG_VALUE_MAX) {
+		return ERROR;
+	}
+	if(configIndex[key].data != NULL && configIndex[key].len == len && memcmp(configIndex[key].data, data, len) == 0) {
+		return SUCCESS;
+	}
+	if(configUsed + CONFIG_RECORD_SIZE(len) > configFlash->size) {
+		if(configCompact() == false) {
+			return ERROR;
+		}
+		if(configUsed + CONFIG_RECORD_SIZE(len) > configFlash->size) {
+			return ERROR;
+		}
+	}
+	const uint32_t offset = configUsed;
+	configUsed += CONFIG_RECORD_SIZE(len); // ص  ڸ ٽ   
+	if(configWriteRecord(configActive, offset, key, data, len) == false) {
+		return ERROR;
+	}
+	configIndex[key].data = configFlash->base[configActive] + offset + 4;
+	configIndex[key].len = len;
+	return SUCCESS;
+}
+
+/*
+ * @brief    б
+ * @param stat: ¸  ü 
+ * @retval 
+ */
+void configGetStat(configStat_t* stat) {
+	stat->generation = configGeneration;
+	stat->used = configUsed;
+	stat->size = (configFlash != NULL) ? configFlash->size : 0;
+	stat->badRecords = configBadRecords;
+}
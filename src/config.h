@@ -0,0 +1,58 @@
+#ifndef _CONFIG_H_
+#define _CONFIG_H_
+
+#include <stm32f4xx.h>
+#include <board.h>
+
+#ifndef bool
+typedef uint8_t bool;
+#define false (bool) 0
+#define true (bool) 1
+#define NULL ((void *)0)
+#endif
+
+#define CONFIG_MAGIC      0x31474643 // "CFG1"
+#define CONFIG_VALUE_MAX  256        //  ϳ ִ Ʈ 
+
+/*
+ * @brief  Ű ü
+ * @note  Ű ȣ ٲ  ڿ ߰Ұ
+ */
+typedef enum {
+	CONFIG_KEY_GYRO_BIAS = 0, // int16_t[3], mpu6050 ̷ 
+	CONFIG_KEY_MAX,
+} configKey_t;
+
+/*
+ * @brief  Ұ  ÷  Ϳ  Լ
+ * @note  ÷ô 0xff, program 1 -> 0 θ ٲ  
+ * 		  ȣƮ  迭  Ģ 䳻 Լ ٲ㼭 (test/test_config.c)
+ */
+typedef struct {
+	const uint8_t* base[2]; //   ּ, 4Ʈ 
+	uint32_t size;          //  ũ
+	bool (*erase)(uint8_t index);
+	bool (*program)(const uint8_t* address, uint32_t data);
+} configFlash_t;
+
+/*
+ * @brief  ÷ 鿣, ʹ board.h
+ */
+extern const configFlash_t configFlashInternal;
+
+/*
+ * @brief   
+ */
+typedef struct {
+	uint32_t generation; // Ҷ 
+	uint32_t used;       //  Ϳ  Ʈ 
+	uint32_t size;
+	uint16_t badRecords; // CRC Ʋ ǳʶ ڵ 
+} configStat_t;
+
+ErrorStatus configInit(const configFlash_t* flash);
+const void* configGet(configKey_t key, uint16_t* len);
+ErrorStatus configSet(configKey_t key, const void* data, uint16_t len);
+void configGetStat(configStat_t* stat);
+
+#endif
@@ -0,0 +1,96 @@
+#include <stm32f4xx.h>
+#include <stm32f4xx_conf.h>
+#include <sbus.h>
+#include <crsf.h>
+
+/*
+ * @brief CRC8 ̺, ù  ˻綧 ä
+ */
+static uint8_t crsfCrcTable[256];
+static bool crsfCrcReady = false;
+
+/*
+ * @brief CRC8 ̺ 
+ * @param 
+ * @retval 
+ */
+static void crsfCrcInit(void) {
+	uint16_t i;
+	uint8_t j;
+	for(i = 0; i < 256; i++) {
+		uint8_t crc = i;
+		for(j = 0; j < 8; j++) {
+			crc = (crc & 0x80) ? (crc << 1) ^ CRSF_CRC_POLY : (crc << 1);
+		}
+		crsfCrcTable[i] = crc;
+	}
+	crsfCrcReady = true;
+}
+
+/*
+ * @brief   Ǵ
+ * @note : ּ(1), (1), Ÿ(1), , crc(1), ̴ ŸԺ crc
+ * @param buf:  Ʈ
+ * @param len:  Ʈ 
+ * @retval  ,  Ʋ 0
+ */
+static uint8_t crsfFrameSize(const uint8_t* buf, uint8_t len) {
+	if(buf[0] != CRSF_ADDRESS_FC && buf[0] != CRSF_ADDRESS_RX && buf[0] != CRSF_ADDRESS_TX) {
+		return 0;
+	}
+	if(len < 2) {
+		return 2;
+	}
+	if(buf[1] < 2) {
+		return 0;
+	}
+	return buf[1] + 2;
+}
+
+/*
+ * @brief CRC ˻, ŸԺ  
+ * @param frame: 
+ * @param size:  
+ * @retval ġϸ true
+ */
+static bool crsfFrameCheck(const uint8_t* frame, uint8_t size) {
+	if(crsfCrcReady == false) {
+		crsfCrcInit();
+	}
+	uint8_t crc = 0;
+	uint8_t i;
+	for(i = 2; i < size - 1; i++) {
+		crc = crsfCrcTable[crc ^ frame[i]];
+	}
+	return crc == frame[size - 1];
+}
+
+/*
+ * @brief ä  Ǯ
+ * @note ä ʹ S.BUS  11Ʈ 16ä 
+ * @param frame: 
+ * @param size:  
+ * @param channel: ä  ȯ  
+ * @retval ä , ä  ƴϸ 0
+ */
+static uint8_t crsfFrameDecode(const uint8_t* frame, uint8_t size, uint16_t* channel) {
+	if(frame[2] != CRSF_TYPE_RC_CHANNELS || size != 3 + 22 + 1) {
+		return 0;
+	}
+	sbusUnpack(frame + 3, channel);
+	return SBUS_CHANNEL_MAX;
+}
+
+/*
+ * @brief CRSF , 420000bps 8N1
+ */
+const serialRxProtocol_t crsfProtocol = {
+	.baudRate = CRSF_BAUDRATE,
+	.parity = USART_Parity_No,
+	.stopBits = USART_StopBits_1,
+	.inverted = false,
+	.frameSizeMax = CRSF_FRAME_SIZE_MAX,
+	.frameSize = crsfFrameSize,
+	.frameCheck = crsfFrameCheck,
+	.frameDecode = crsfFrameDecode,
+};
@@ -0,0 +1,16 @@
+#ifndef _CRSF_H_
+#define _CRSF_H_
+
+#include <serialrx.h>
+
+#define CRSF_BAUDRATE           420000
+#define CRSF_FRAME_SIZE_MAX     64
+#define CRSF_ADDRESS_FC         0xc8
+#define CRSF_ADDRESS_RX         0xec
+#define CRSF_ADDRESS_TX         0xee
+#define CRSF_TYPE_RC_CHANNELS   0x16
+#define CRSF_CRC_POLY           0xd5 // DVB-S2
+
+extern const serialRxProtocol_t crsfProtocol;
+
+#endif
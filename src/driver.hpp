@@ -0,0 +1,144 @@
+#ifndef _DRIVER_HPP_
+#define _DRIVER_HPP_
+
+#include <board.hpp>
+
+extern "C" {
+#include <mpu6050.h>
+#include <system.h>
+}
+
+/*
+ * @brief Ʈ Ļ, ) Uart<UART_DEVICE_6>::init(115200);
+ * @note  Լ static ζ̰ ġ ȣ  C ̹ ȣ ð ڷ,
+ * 		    ּ  ٷ , ü  ʿ 
+ */
+template<uartDevice_t D>
+class Uart {
+	typedef UartBoard<D> Board;
+	static_assert(Board::valid, " 忡  ִ Ʈ, board.h ׸ ȮҰ");
+
+public:
+	static void init(uint32_t baudRate) {
+		uartInitTypeDef_t uartInitStructure;
+		uartStructInit(&uartInitStructure);
+		uartInitStructure.baudRate = baudRate;
+		uartInit(D, &uartInitStructure);
+	}
+
+	static void init(uartInitTypeDef_t* uartInitStruct) {
+		uartInit(D, uartInitStruct);
+	}
+
+	static void putChar(uint8_t c) {
+		uartPutChar(D, c);
+	}
+
+	static void write(const uint8_t* data, uint16_t len) {
+		uartWrite(D, data, len);
+	}
+
+	static uint8_t getChar(void) {
+		return uartGetChar(D);
+	}
+
+	static uint16_t available(void) {
+		return uartAvailable(D);
+	}
+
+	static USART_TypeDef* regs(void) {
+		return Board::uart();
+	}
+
+	/*
+	 * @brief ۽ ۿ ͷƮ ġ ʰ Ϳ ٷ 
+	 * @note Ʈ ڵ鷯  ʱó ͷƮ   ,  ۽Ű   
+	 */
+	static void putCharBlocking(uint8_t c) {
+		while((regs()->SR & USART_SR_TXE) == 0);
+		regs()->DR = c;
+	}
+};
+
+/*
+ * @brief i2c  Ļ, ) I2cBus<I2C_DEVICE_1>::read(0x68, reg, 6, buf);
+ */
+template<i2cDevice_t D>
+class I2cBus {
+	typedef I2cBoard<D> Board;
+	static_assert(Board::valid, " 忡  ִ i2c, board.h ׸ ȮҰ");
+
+public:
+	static constexpr i2cDevice_t device = D;
+
+	static void init(uint32_t clockSpeed = 400000) {
+		i2cInitTypeDef_t i2cInitStructure;
+		i2cStructInit(&i2cInitStructure);
+		i2cInitStructure.clockSpeed = clockSpeed;
+		i2cInit(D, &i2cInitStructure);
+	}
+
+	static bool write(uint8_t addr, uint8_t reg, uint8_t data) {
+		return i2cWrite(D, addr, reg, data) == SUCCESS;
+	}
+
+	static bool writeBuffer(uint8_t addr, uint8_t reg, uint8_t len, uint8_t* data) {
+		return i2cWriteBuffer(D, addr, reg, len, data) == SUCCESS;
+	}
+
+	static bool read(uint8_t addr, uint8_t reg, uint8_t len, uint8_t* buf) {
+		return i2cRead(D, addr, reg, len, buf) == SUCCESS;
+	}
+
+	static I2C_TypeDef* regs(void) {
+		return Board::i2c();
+	}
+};
+
+/*
+ * @brief mpu6050 Ļ, ) Mpu6050<I2cBus<I2C_DEVICE_1> >::init();
+ * @note  ŸԿ , ּҴ C ̹  MPU6050_ADDRESS ϳ(init mpu6050Init ״ θǷ)
+ * 		  init  Ǯ,  Ȯ,   ҷ mpu6050Init 
+ * 		  readAcc, readGyro mpu6050Read  ( ȯ, ̷   )
+ * 		     C ̹ (mpu6050Update, mpu6050GetSnapshot) 
+ */
+template<typename Bus>
+class Mpu6050 {
+	static const uint8_t Addr = MPU6050_ADDRESS;
+
+	static bool readAxes(uint8_t reg, int16_t* raw) {
+		uint8_t buf8[6];
+		if(Bus::read(Addr, reg, 6, buf8) == false) {
+			return false;
+		}
+		raw[0] = (int16_t)((buf8[0] << 8) | buf8[1]);
+		raw[1] = (int16_t)((buf8[2] << 8) | buf8[3]);
+		raw[2] = (int16_t)((buf8[4] << 8) | buf8[5]);
+		return true;
+	}
+
+public:
+	static bool init(void) {
+		return mpu6050Init(Bus::device) == SUCCESS;
+	}
+
+	static bool readAcc(int16_t* data) {
+		int16_t raw[3];
+		if(readAxes(MPU_RA_ACCEL_XOUT_H, raw) == false) {
+			return false;
+		}
+		ACC_ORIENTATION(data[0], data[1], data[2], raw[0], raw[1], raw[2]);
+		return true;
+	}
+
+	static bool readGyro(int16_t* data) {
+		int16_t raw[3];
+		if(readAxes(MPU_RA_GYRO_XOUT_H, raw) == false) {
+			return false;
+		}
+		GYRO_ORIENTATION(data[0], data[1], data[2], raw[0], raw[1], raw[2]);
+		return true;
+	}
+};
+
+#endif
@@ -1,38 +1,47 @@
 #include <stm32f4xx.h>
 #include <stm32f4xx_conf.h>
 #include <drv_exti.h>
+#include <profiler.h>
+#include <system.h>
 
 /*
- * @brief ܺͷƮ  ݹ Լ 迭
+ * @brief ܺͷƮ ϵ ,  ǿ ѹ 
  */
-static extiFuncPtr_t extiFuncPtr[16];
+const extiHardwareMap_t extiHardwareMap[MAX_EXTI_DEVICE] = {
+	{ BOARD_EXTI0 }, { BOARD_EXTI1 }, { BOARD_EXTI2 }, { BOARD_EXTI3 }, { BOARD_EXTI4 }, { BOARD_EXTI5 }, { BOARD_EXTI6 }, { BOARD_EXTI7 },
+	{ BOARD_EXTI8 }, { BOARD_EXTI9 }, { BOARD_EXTI10 }, { BOARD_EXTI11 }, { BOARD_EXTI12 }, { BOARD_EXTI13 }, { BOARD_EXTI14 }, { BOARD_EXTI15 },
+};
 
 /*
- * @brief ܺͷƮ ȣ  
+ * @brief ܺͷƮ ݹ Լ ؽƮ 迭,  ȣ ٷ ã
  */
-static uint8_t extiChannelMap[16] = {
-		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
+static extiFuncPtr_t extiFuncPtr[MAX_EXTI_DEVICE];
+static void* extiContext[MAX_EXTI_DEVICE];
 
 /*
- * @brief ܺͷƮ ä 
- * @param extiDevice: ܺͷƮ ġ ü
- * @param channel: ܺͷƮ ʱȭ  ü 
- * @retval 
+ * @brief κ    Ʈ,  ȣ  ȣ 
  */
-void extiChannelMapping(extiDevice_t extiDevice, uint8_t channel) {
-	extiChannelMap[extiDevice] = channel;
-}
+static GPIO_TypeDef* extiGpio[MAX_EXTI_DEVICE];
+
+/*
+ * @brief κ ġ  
+ */
+static extiLatency_t extiLatency[MAX_EXTI_DEVICE];
+
+/*
+ * @brief ݹ ϵ  Ʈũ
+ */
+static volatile uint32_t extiActiveMask = 0;
 
 /*
  * @brief ܺͷƮ ʱȭ
  * @param extiDevice: ܺͷƮ ġ ü
  * @param extiInitStruct: ܺͷƮ ʱȭ  ü 
  * @param extiFuncPtr_: ܺͷƮ ISR ȣ Լ 
+ * @param context: ݹ鿡 Ѱ  ؽƮ 
  * @retval 
  */
-void extiInit(extiDevice_t extiDevice, extiInitTypeDef_t* extiInitStruct, extiFuncPtr_t extiFuncPtr_) {
+void extiInit(extiDevice_t extiDevice, extiInitTypeDef_t* extiInitStruct, extiFuncPtr_t extiFuncPtr_, void* context) {
 	// clock Ȱȭ
 	RCC_APB2PeriphClockCmd(RCC_APB2Periph_SYSCFG, ENABLE);
 	RCC_AHB1PeriphClockCmd(extiHardwareMap[extiDevice].periph, ENABLE);
@@ -46,6 +55,12 @@ void extiInit(extiDevice_t extiDevice, extiInitTypeDef_t* extiInitStruct, extiFu
 	GPIO_InitStructure.GPIO_Speed = GPIO_Speed_25MHz;
 	GPIO_Init(extiHardwareMap[extiDevice].gpio, &GPIO_InitStructure);
 
+	// ȣ Լ , ͷƮ ѱ  ؾ
+	extiFuncPtr[extiDevice] = extiFuncPtr_;
+	extiContext[extiDevice] = context;
+	extiGpio[extiDevice] = extiHardwareMap[extiDevice].gpio;
+	extiActiveMask |= 1 << extiDevice;
+
 	// exti Ҵ
 	SYSCFG_EXTILineConfig(extiHardwareMap[extiDevice].portSource, extiHardwareMap[extiDevice].pinSource);
 
@@ -64,78 +79,113 @@ void extiInit(extiDevice_t extiDevice, extiInitTypeDef_t* extiInitStruct, extiFu
 	NVIC_InitStructure.NVIC_IRQChannelSubPriority = extiInitStruct->SubPriority;
 	NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
 	NVIC_Init(&NVIC_InitStructure);
+}
 
-	// ȣ Լ 
-	extiFuncPtr[extiDevice] = extiFuncPtr_;
+/*
+ * @brief ġ   б
+ * @param extiDevice: ܺͷƮ ġ ü
+ * @param latency: 踦  ü 
+ * @retval 
+ */
+void extiGetLatency(extiDevice_t extiDevice, extiLatency_t* latency) {
+	const uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	*latency = extiLatency[extiDevice];
+	__set_PRIMASK(primask);
+}
+
+/*
+ * @brief Ͱ ϴ   ݹ ϵ    б
+ * @note  Ϳ  ð ٷ  θ, PR ó Ϸ    ̰  ª
+ * 		   (EXTI9_5, EXTI15_10) ϵ  ŭ IDR ,  1~2
+ * @param lines:  Ͱ ϴ  Ʈũ
+ * @retval  ȣ ڸ    Ʈũ
+ */
+static inline uint32_t extiSampleLevel(uint32_t lines) {
+	uint32_t scan = lines & extiActiveMask;
+	uint32_t level = 0;
+	while(scan) {
+		const uint8_t line = 31 - __CLZ(scan);
+		scan &= ~(1UL << line);
+		level |= extiGpio[line]->IDR & (1UL << line);
+	}
+	return level;
 }
 
 /*
  * @brief ܺͷƮ ͷƮ ڵ鷯
- * @note 1020~1980 ͸  ޵  Ǿ Ƿ
- * 		     ű  ϰ ؼ ϵ ..  ʹ 1100~1900 ؼ 뿹
- * 		  ,   1050~1950̰, ִ 1020~1980, ּһ 1100~1900
- * @param channel: x 1  5 ڰ 
+ * @note PR ѹ о    Ÿ ѹ clear(1  clear)
+ * 		   Ʈ CLZ  ݹ ȣϹǷ   ŭ  
+ * @param entry:    Ŭ īƮ
+ * @param level: Ϳ     (extiSampleLevel)
+ * @param lines:  Ͱ ϴ  Ʈũ
  * @retval 
  */
-static void extiHandler(extiDevice_t channel) {
-	uint8_t chan = extiChannelMap[channel]; //EXTI Channel о, ) exti2 -> THR
-	if(chan == 0xff) {
-		return;
+static void extiHandler(uint32_t entry, uint32_t level, uint32_t lines) {
+	PROFILE_ENTER();
+	uint32_t pending = EXTI->PR & lines & extiActiveMask;
+	EXTI->PR = pending;
+
+	while(pending) {
+		const uint8_t line = 31 - __CLZ(pending);
+		pending &= ~(1UL << line);
+
+		extiLatency_t* latency = &extiLatency[line];
+		const uint32_t delay = cycles() - entry;
+		latency->lastCycles = delay;
+		latency->avgCycles = (latency->sampleCount == 0) ? delay : latency->avgCycles + ((int32_t)(delay - latency->avgCycles) >> 4);
+		if(delay > latency->maxCycles) {
+			latency->maxCycles = delay;
+		}
+		latency->sampleCount++;
+
+		extiFuncPtr[line](extiContext[line], entry, (level >> line) & 1);
 	}
-	extiFuncPtr[channel](chan);
+	PROFILE_EXIT(PROF_EXTI);
 }
 
+/*
+ * @note  ð     ù  忡 , ϵ ŷ(12Ŭ) ׻ Ƿ  ð ̴ 
+ * 		       Ƿ  ð   
+ */
 void EXTI0_IRQHandler(void) {
-	if(EXTI_GetITStatus(EXTI_Line0) == SET) { //ͷƮ ÷װ setǾ
-		EXTI_ClearITPendingBit(EXTI_Line0); //ͷƮ ÷ clear
-		extiHandler(EXTI_DEVICE_0); //pulse ð  Լ ȣ
-	}
+	const uint32_t entry = cycles();
+	const uint32_t level = extiSampleLevel(EXTI_Line0);
+	extiHandler(entry, level, EXTI_Line0);
 }
 
 void EXTI1_IRQHandler(void) {
-	if(EXTI_GetITStatus(EXTI_Line1) == SET) {
-		EXTI_ClearITPendingBit(EXTI_Line1);
-		extiHandler(EXTI_DEVICE_1);
-	}
+	const uint32_t entry = cycles();
+	const uint32_t level = extiSampleLevel(EXTI_Line1);
+	extiHandler(entry, level, EXTI_Line1);
 }
 
 void EXTI2_IRQHandler(void) {
-	if(EXTI_GetITStatus(EXTI_Line2) == SET) {
-		EXTI_ClearITPendingBit(EXTI_Line2);
-		extiHandler(EXTI_DEVICE_2);
-	}
+	const uint32_t entry = cycles();
+	const uint32_t level = extiSampleLevel(EXTI_Line2);
+	extiHandler(entry, level, EXTI_Line2);
 }
 
 void EXTI3_IRQHandler(void) {
-	if(EXTI_GetITStatus(EXTI_Line3) == SET) {
-		EXTI_ClearITPendingBit(EXTI_Line3);
-		extiHandler(EXTI_DEVICE_3);
-	}
+	const uint32_t entry = cycles();
+	const uint32_t level = extiSampleLevel(EXTI_Line3);
+	extiHandler(entry, level, EXTI_Line3);
 }
 
 void EXTI4_IRQHandler(void) {
-	if(EXTI_GetITStatus(EXTI_Line4) == SET) {
-		EXTI_ClearITPendingBit(EXTI_Line4);
-		extiHandler(EXTI_DEVICE_4);
-	}
+	const uint32_t entry = cycles();
+	const uint32_t level = extiSampleLevel(EXTI_Line4);
+	extiHandler(entry, level, EXTI_Line4);
 }
 
 void EXTI9_5_IRQHandler(void) {
-	uint8_t i = 5;
-	for(; i <= 9; i++) {//5 ~ 9
-		if(EXTI_GetITStatus(1 << i) == SET) { // 1<<5 ~ 1<<9, EXTI_Line5 ~ EXTI_Line9
-			EXTI_ClearITPendingBit(1 << i);
-			extiHandler(i); //5 ~ 9, EXTI5 ~ EXTI9
-		}
-	}
+	const uint32_t entry = cycles();
+	const uint32_t level = extiSampleLevel(EXTI_Line5 | EXTI_Line6 | EXTI_Line7 | EXTI_Line8 | EXTI_Line9);
+	extiHandler(entry, level, EXTI_Line5 | EXTI_Line6 | EXTI_Line7 | EXTI_Line8 | EXTI_Line9);
 }
 
 void EXTI15_10_IRQHandler(void) {
-	uint8_t i = 10;
-	for(; i <= 15; i++) {
-		if(EXTI_GetITStatus(1 << i) == SET) {
-			EXTI_ClearITPendingBit(1 << i);
-			extiHandler(i);
-		}
-	}
+	const uint32_t entry = cycles();
+	const uint32_t level = extiSampleLevel(EXTI_Line10 | EXTI_Line11 | EXTI_Line12 | EXTI_Line13 | EXTI_Line14 | EXTI_Line15);
+	extiHandler(entry, level, EXTI_Line10 | EXTI_Line11 | EXTI_Line12 | EXTI_Line13 | EXTI_Line14 | EXTI_Line15);
 }
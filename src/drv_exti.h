@@ -3,6 +3,7 @@
 
 #include <stm32f4xx.h>
 #include <stm32f4xx_conf.h>
+#include <board.h>
 
 #ifndef bool
 typedef uint8_t bool;
@@ -48,26 +49,9 @@ typedef struct {
 } extiHardwareMap_t;
 
 /*
- * @brief ܺͷƮ ϵ 
+ * @brief ܺͷƮ ϵ ,  board.h
  */
-static const extiHardwareMap_t extiHardwareMap[] = {
-	{ NULL, GPIO_Pin_0, 0xff, EXTI_PinSource0, EXTI_Line0, EXTI0_IRQn, 0xff },
-	{ NULL, GPIO_Pin_1, 0xff, EXTI_PinSource1, EXTI_Line1, EXTI1_IRQn, 0xff },
-	{ GPIOD, GPIO_Pin_2, EXTI_PortSourceGPIOD, EXTI_PinSource2, EXTI_Line2, EXTI2_IRQn, RCC_AHB1Periph_GPIOD }, // EXTI_2
-	{ GPIOC, GPIO_Pin_3, EXTI_PortSourceGPIOC, EXTI_PinSource3, EXTI_Line3, EXTI3_IRQn, RCC_AHB1Periph_GPIOC }, // EXTI_3
-	{ GPIOA, GPIO_Pin_4, EXTI_PortSourceGPIOA, EXTI_PinSource4, EXTI_Line4, EXTI4_IRQn, RCC_AHB1Periph_GPIOA }, // EXTI_4
-	{ GPIOA, GPIO_Pin_5, EXTI_PortSourceGPIOA, EXTI_PinSource5, EXTI_Line5, EXTI9_5_IRQn, RCC_AHB1Periph_GPIOA }, // EXTI_5
-	{ NULL, GPIO_Pin_6, 0xff, EXTI_PinSource6, EXTI_Line6, EXTI9_5_IRQn, 0xff },
-	{ NULL, GPIO_Pin_7, 0xff, EXTI_PinSource7, EXTI_Line7, EXTI9_5_IRQn, 0xff },
-	{ NULL, GPIO_Pin_8, 0xff, EXTI_PinSource8, EXTI_Line8, EXTI9_5_IRQn, 0xff },
-	{ NULL, GPIO_Pin_9, 0xff, EXTI_PinSource9, EXTI_Line9, EXTI9_5_IRQn, 0xff },
-	{ NULL, GPIO_Pin_10, 0xff, EXTI_PinSource10, EXTI_Line10, EXTI15_10_IRQn, 0xff },
-	{ NULL, GPIO_Pin_11, 0xff, EXTI_PinSource11, EXTI_Line11, EXTI15_10_IRQn, 0xff },
-	{ GPIOC, GPIO_Pin_12, EXTI_PortSourceGPIOC, EXTI_PinSource12, EXTI_Line12, EXTI15_10_IRQn, RCC_AHB1Periph_GPIOC }, // EXTI_12
-	{ NULL, GPIO_Pin_13, 0xff, EXTI_PinSource13, EXTI_Line13, EXTI15_10_IRQn, 0xff },
-	{ NULL, GPIO_Pin_14, 0xff, EXTI_PinSource14, EXTI_Line14, EXTI15_10_IRQn, 0xff },
-	{ GPIOB, GPIO_Pin_15, EXTI_PortSourceGPIOB, EXTI_PinSource15, EXTI_Line15, EXTI15_10_IRQn, RCC_AHB1Periph_GPIOB }, // EXTI_15
-};
+extern const extiHardwareMap_t extiHardwareMap[MAX_EXTI_DEVICE];
 
 /*
  * @brief ܺͷƮ ʱȭ Ÿ ü
@@ -80,11 +64,23 @@ typedef struct
 } extiInitTypeDef_t;
 
 /*
- * @brief ܺͷƮ  ݹ Լ
+ * @brief ܺͷƮ ݹ Լ
+ * @note : Ҷ ѱ  ؽƮ , ͷƮ  ð(cycles),     
  */
-typedef void (*extiFuncPtr_t) (extiDevice_t);
+typedef void (*extiFuncPtr_t) (void*, uint32_t, bool);
 
-void extiInit(extiDevice_t extiDevice, extiInitTypeDef_t* extiInitStruct, extiFuncPtr_t extiFunc_);
-void extiChannelMapping(extiDevice_t extiDevice, uint8_t channel);
+/*
+ * @brief κ ġ  , Ŭ 
+ * @note ͷƮ  ð ݹ ȣϱ 
+ */
+typedef struct {
+	uint32_t lastCycles;
+	uint32_t avgCycles;
+	uint32_t maxCycles;
+	uint32_t sampleCount;
+} extiLatency_t;
+
+void extiInit(extiDevice_t extiDevice, extiInitTypeDef_t* extiInitStruct, extiFuncPtr_t extiFunc_, void* context);
+void extiGetLatency(extiDevice_t extiDevice, extiLatency_t* latency);
 
 #endif
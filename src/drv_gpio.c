@@ -0,0 +1,48 @@
+#include <stm32f4xx.h>
+#include <stm32f4xx_conf.h>
+#include <drv_gpio.h>
+#include <system.h>
+
+/*
+ * @brief   ӵ 
+ * @note  ̸  Ǿ ־, ߿ ͷƮ Ƿ  ĳ ܿθ ȣ
+ * 		      ӵ Ⱑ ļ ǹǷ  带    
+ * @param gpio: Ʈ
+ * @param pin:  ȣ(0 ~ 15)
+ * @param result:   ü 
+ * @retval 
+ */
+void gpioBenchmark(GPIO_TypeDef* gpio, uint8_t pin, gpioBenchmark_t* result) {
+	const uint16_t mask = 1 << pin;
+	uint32_t i, start;
+	const uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	start = cycles();
+	for(i = 0; i < GPIO_BENCHMARK_COUNT / 2; i++) {
+		gpioSet(gpio, mask);
+		gpioClear(gpio, mask);
+	}
+	result->bsrrCycles = (cycles() - start) / GPIO_BENCHMARK_COUNT;
+
+	start = cycles();
+	for(i = 0; i < GPIO_BENCHMARK_COUNT; i++) {
+		gpioToggle(gpio, mask);
+	}
+	result->toggleCycles = (cycles() - start) / GPIO_BENCHMARK_COUNT;
+
+	start = cycles();
+	for(i = 0; i < GPIO_BENCHMARK_COUNT / 2; i++) {
+		gpioBitWrite(gpio, pin, 1);
+		gpioBitWrite(gpio, pin, 0);
+	}
+	result->bitbandCycles = (cycles() - start) / GPIO_BENCHMARK_COUNT;
+
+	start = cycles();
+	for(i = 0; i < GPIO_BENCHMARK_COUNT; i++) {
+		gpio->ODR ^= mask;
+	}
+	result->odrCycles = (cycles() - start) / GPIO_BENCHMARK_COUNT;
+
+	__set_PRIMASK(primask);
+}
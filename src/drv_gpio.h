@@ -0,0 +1,115 @@
+#ifndef _GPIO_H_
+#define _GPIO_H_
+
+#include <stddef.h>
+#include <stm32f4xx.h>
+
+#ifndef bool
+typedef uint8_t bool;
+#define false (bool) 0
+#define true (bool) 1
+#define NULL ((void *)0)
+#endif
+
+#define GPIO_BENCHMARK_COUNT 1000 //   Ƚ
+
+/*
+ * @brief Ʈ Ī ּ, ֺġ (0x40000000 ~ 0x400fffff)  Ʈ  
+ * @note Ī    Ʈ  ħ(read-modify-write  ƴ )
+ */
+#define GPIO_BITBAND(reg, bit) (*(volatile uint32_t *)(PERIPH_BB_BASE + (((uintptr_t)(reg) - PERIPH_BASE) << 5) + ((bit) << 2)))
+
+/*
+ * @brief BSRRL, BSRRH ģ 32Ʈ BSRR, Ʒ 16Ʈ set,  16Ʈ reset
+ * @note Ʈ ּҿ  ؼ 16Ʈ  32Ʈ д  ȯ(strict aliasing) 
+ */
+#define GPIO_BSRR(gpio) (*(volatile uint32_t *)((uintptr_t)(gpio) + offsetof(GPIO_TypeDef, BSRRL)))
+
+/*
+ * @brief    ,  ѹ Ŭ
+ */
+typedef struct {
+	uint32_t bsrrCycles;    // gpioSet/gpioClear 
+	uint32_t toggleCycles;  // gpioToggle
+	uint32_t bitbandCycles; // gpioBitWrite 
+	uint32_t odrCycles;     //   ODR ^=, 񱳿
+} gpioBenchmark_t;
+
+/*
+ * @brief  set,    
+ * @param gpio: Ʈ
+ * @param pins: GPIO_Pin_x Ʈũ
+ * @retval 
+ */
+static inline void gpioSet(GPIO_TypeDef* gpio, uint16_t pins) {
+	gpio->BSRRL = pins;
+}
+
+/*
+ * @brief  clear,    
+ * @param gpio: Ʈ
+ * @param pins: GPIO_Pin_x Ʈũ
+ * @retval 
+ */
+static inline void gpioClear(GPIO_TypeDef* gpio, uint16_t pins) {
+	gpio->BSRRH = pins;
+}
+
+/*
+ * @brief Ʈ   ѹ 
+ * @note BSRR 32Ʈ    mask   value set/clear, mask   ״
+ * @param gpio: Ʈ
+ * @param mask: ٲ  Ʈũ
+ * @param value:   Ʈũ
+ * @retval 
+ */
+static inline void gpioWrite(GPIO_TypeDef* gpio, uint16_t mask, uint16_t value) {
+	GPIO_BSRR(gpio) = ((uint32_t)(mask & ~value) << 16) | (mask & value);
+}
+
+/*
+ * @brief  
+ * @note ODR а BSRR    ٲٹǷ  Ʈ ٸ  ͷƮ   
+ * @param gpio: Ʈ
+ * @param pins: GPIO_Pin_x Ʈũ
+ * @retval 
+ */
+static inline void gpioToggle(GPIO_TypeDef* gpio, uint16_t pins) {
+	const uint32_t odr = gpio->ODR;
+	GPIO_BSRR(gpio) = ((odr & pins) << 16) | (~odr & pins);
+}
+
+/*
+ * @brief  б
+ * @param gpio: Ʈ
+ * @param pins: GPIO_Pin_x Ʈũ
+ * @retval Է Ϳ pins شϴ Ʈ
+ */
+static inline uint16_t gpioRead(GPIO_TypeDef* gpio, uint16_t pins) {
+	return gpio->IDR & pins;
+}
+
+/*
+ * @brief Ʈ  ϳ 
+ * @param gpio: Ʈ
+ * @param pin:  ȣ(0 ~ 15), ũ ƴ
+ * @param value:  
+ * @retval 
+ */
+static inline void gpioBitWrite(GPIO_TypeDef* gpio, uint8_t pin, bool value) {
+	GPIO_BITBAND(&gpio->ODR, pin) = value;
+}
+
+/*
+ * @brief Ʈ  ϳ б
+ * @param gpio: Ʈ
+ * @param pin:  ȣ(0 ~ 15), ũ ƴ
+ * @retval  (0, 1)
+ */
+static inline bool gpioBitRead(GPIO_TypeDef* gpio, uint8_t pin) {
+	return GPIO_BITBAND(&gpio->IDR, pin);
+}
+
+void gpioBenchmark(GPIO_TypeDef* gpio, uint8_t pin, gpioBenchmark_t* result);
+
+#endif
@@ -1,15 +1,31 @@
 #include <stm32f4xx.h>
 #include <stm32f4xx_conf.h>
 #include <drv_i2c.h>
+#include <drv_gpio.h>
+#include <ccm.h>
 #include <system.h>
+#include <profiler.h>
 
 /*
  *  -	 "https://code.google.com/p/afrodevices/wiki/AfroFlight"
  */
 
+/*
+ * @brief i2c ϵ ,  ǿ ѹ 
+ */
+const i2cHardwareMap_t i2cHardwareMap[MAX_I2C_DEVICE] = {
+	{ BOARD_I2C1 }, { BOARD_I2C2 },
+};
+
 static void i2cErHandler(i2cDevice_t i2cDevice);
 static void i2cEvHandler(i2cDevice_t i2cDevice);
-static void i2cUnstick(i2cDevice_t i2cDevice);
+static int32_t i2cUnstick(i2cDevice_t i2cDevice, uint8_t* phase);
+static void i2cConfigure(i2cDevice_t i2cDevice);
+
+/*
+ * @brief ġ  ӵ, ʱȭ  ġ 0
+ */
+static uint32_t i2cClockSpeed[MAX_I2C_DEVICE];
 
 /*
  * @brief i2c ī
@@ -23,18 +39,19 @@ static volatile int8_t error = false;
 /*
  * @brief i2c ϶
  */
-static volatile int8_t busy;
+static volatile int8_t busy CCM_BSS;
 
 /*
  * @brief  i2c ְ޴ 
+ * @note ͷƮθ ְǷ(DMA ) CCM 
  */
-static volatile uint8_t addr; //  ġ ּ
-static volatile uint8_t reg; //  ּ
-static volatile uint8_t bytes; // ų  Ʈ 
-static volatile uint8_t writing; // ¸
-static volatile uint8_t reading; // д¸
-static volatile uint8_t* writePtr; // ҷͼ   
-static volatile uint8_t* readPtr; // о   
+static volatile uint8_t addr CCM_BSS; //  ġ ּ
+static volatile uint8_t reg CCM_BSS; //  ּ
+static volatile uint8_t bytes CCM_BSS; // ų  Ʈ 
+static volatile uint8_t writing CCM_BSS; // ¸
+static volatile uint8_t reading CCM_BSS; // д¸
+static volatile uint8_t* writePtr CCM_BSS; // ҷͼ   
+static volatile uint8_t* readPtr CCM_BSS; // о   
 
 /*
  * @brief i2c ʱȭ ü ʱ⼳
@@ -176,6 +193,7 @@ ErrorStatus i2cRead(i2cDevice_t i2cDevice, uint8_t addr_, uint8_t reg_, uint8_t
  */
 static void i2cErHandler(i2cDevice_t i2cDevice)
 {
+	PROFILE_ENTER();
 	I2C_TypeDef *I2Cx = i2cHardwareMap[i2cDevice].i2c;
     // Read the I2C1 status register
     volatile uint32_t SR1Reg = I2Cx->SR1;
@@ -202,6 +220,7 @@ static void i2cErHandler(i2cDevice_t i2cDevice)
     }
     I2Cx->SR1 &= ~0x0F00;                                               // reset all the error bits to clear the interrupt
     busy = false;
+    PROFILE_EXIT(PROF_I2C_ER);
 }
 
 /*
@@ -211,6 +230,7 @@ static void i2cErHandler(i2cDevice_t i2cDevice)
  */
 static void i2cEvHandler(i2cDevice_t i2cDevice)
 {
+	PROFILE_ENTER();
 	I2C_TypeDef *I2Cx = i2cHardwareMap[i2cDevice].i2c;
 	static uint8_t subaddress_sent;                         // flag to indicate if subaddess sent, flag to indicate final bus condition
 	static int8_t index;                                                // index is signed -1 == send the subaddress
@@ -315,35 +335,55 @@ static void i2cEvHandler(i2cDevice_t i2cDevice)
 		I2C_ITConfig(I2Cx, I2C_IT_EVT | I2C_IT_ERR, DISABLE);       // Disable EVT and ERR interrupts while bus inactive
 		busy = false;
 	}
+	PROFILE_EXIT(PROF_I2C_EV);
 }
 
 /*
  * @brief i2c ʱȭ
+ * @note i2cInitStep  ,  Ǫ  200us  ٸ
  * @param i2cDevice: i2c ġ ü
  * @param i2cInitStruct: i2c ʱȭ ⺻  ü 
  * @retval 
  */
 void i2cInit(i2cDevice_t i2cDevice, i2cInitTypeDef_t* i2cInitStruct)
 {
-    I2C_TypeDef *I2Cx = i2cHardwareMap[i2cDevice].i2c;
+    uint8_t phase = 0;
+    int32_t wait;
+    while ((wait = i2cInitStep(i2cDevice, i2cInitStruct, &phase)) > 0) {
+        delayMicroseconds(wait);
+    }
+}
 
-    RCC_AHB1PeriphClockCmd(i2cHardwareMap[i2cDevice].gpioPeriph, ENABLE);
-    RCC_APB1PeriphClockCmd(i2cHardwareMap[i2cDevice].i2cPeriph, ENABLE);
+/*
+ * @brief i2c ʱȭ  ܰ 
+ * @note  Ǫ Ŭ ̿ ٸ ʰ ٸ ð , ׵ ٸ ġ ʱȭ  (startup.h)
+ * @param i2cDevice: i2c ġ ü
+ * @param i2cInitStruct: i2c ʱȭ ⺻  ü ,  ؾ
+ * @param phase:  ܰ, ó 0
+ * @retval ٽ θ ٸ ð(us),  0
+ */
+int32_t i2cInitStep(i2cDevice_t i2cDevice, i2cInitTypeDef_t* i2cInitStruct, uint8_t* phase)
+{
+    I2C_TypeDef *I2Cx = i2cHardwareMap[i2cDevice].i2c;
 
-    i2cUnstick(i2cDevice);
+    if (*phase == 0) {
+        RCC_AHB1PeriphClockCmd(i2cHardwareMap[i2cDevice].gpioPeriph, ENABLE);
+        RCC_APB1PeriphClockCmd(i2cHardwareMap[i2cDevice].i2cPeriph, ENABLE);
+    }
+    if (*phase < I2C_UNSTICK_PHASES) {
+        const int32_t wait = i2cUnstick(i2cDevice, phase);
+        if (wait != 0) {
+            return wait;
+        }
+    }
 
     I2C_DeInit(I2Cx);
 
-    GPIO_PinAFConfig(i2cHardwareMap[i2cDevice].gpio, 6, GPIO_AF_I2C1);
-    GPIO_PinAFConfig(i2cHardwareMap[i2cDevice].gpio, 7, GPIO_AF_I2C1);
+    GPIO_PinAFConfig(i2cHardwareMap[i2cDevice].gpio, i2cHardwareMap[i2cDevice].sclPinSource, i2cHardwareMap[i2cDevice].gpioAF);
+    GPIO_PinAFConfig(i2cHardwareMap[i2cDevice].gpio, i2cHardwareMap[i2cDevice].sdaPinSource, i2cHardwareMap[i2cDevice].gpioAF);
 
-    I2C_InitTypeDef I2C_InitStructure;
-    I2C_StructInit(&I2C_InitStructure);
-    I2C_InitStructure.I2C_Mode = I2C_Mode_I2C;
-    I2C_InitStructure.I2C_DutyCycle = I2C_DutyCycle_2;
-    I2C_InitStructure.I2C_AcknowledgedAddress = I2C_AcknowledgedAddress_7bit;
-    I2C_InitStructure.I2C_ClockSpeed = i2cInitStruct->clockSpeed; //400000
-    I2C_Init(I2Cx, &I2C_InitStructure);
+    i2cClockSpeed[i2cDevice] = i2cInitStruct->clockSpeed; //400000
+    i2cConfigure(i2cDevice);
 
     I2C_ITConfig(I2Cx, I2C_IT_EVT | I2C_IT_ERR, DISABLE);
 
@@ -358,85 +398,123 @@ void i2cInit(i2cDevice_t i2cDevice, i2cInitTypeDef_t* i2cInitStruct)
     NVIC_Init(&NVIC_InitStructure);
 
     I2C_Cmd(I2Cx, ENABLE);
+    return 0;
 }
 
 /*
- * @brief i2c  ī б
- * @param 
- * @retval i2cErrorCount(uint16_t)
+ * @brief i2c Ÿ̹ 
+ * @note FREQ, CCR, TRISE PCLK1 ǹǷ Ŭ ٲ ٽ ؾ
+ * @param i2cDevice: i2c ġ ü
+ * @retval 
  */
-uint16_t i2cGetErrorCounter(void)
+static void i2cConfigure(i2cDevice_t i2cDevice)
 {
-    return i2cErrorCount;
+    I2C_InitTypeDef I2C_InitStructure;
+    I2C_StructInit(&I2C_InitStructure);
+    I2C_InitStructure.I2C_Mode = I2C_Mode_I2C;
+    I2C_InitStructure.I2C_DutyCycle = I2C_DutyCycle_2;
+    I2C_InitStructure.I2C_AcknowledgedAddress = I2C_AcknowledgedAddress_7bit;
+    I2C_InitStructure.I2C_ClockSpeed = i2cClockSpeed[i2cDevice];
+    I2C_Init(i2cHardwareMap[i2cDevice].i2c, &I2C_InitStructure);
 }
 
 /*
- * @brief i2c 
+ * @brief Ŭ ٲ  i2c Ÿ̹ ٽ 
+ * @note ְ޴ ߿ θ ȵ, clockConfigure θ
  * @param 
  * @retval 
  */
-static void i2cDelay(void) {
-	delayMicroseconds(10);
+void i2cClockUpdate(void)
+{
+    uint8_t i;
+    for (i = 0; i < MAX_I2C_DEVICE; i++) {
+        if (i2cClockSpeed[i] == 0) {
+            continue;
+        }
+        I2C_Cmd(i2cHardwareMap[i].i2c, DISABLE);
+        i2cConfigure(i);
+        I2C_Cmd(i2cHardwareMap[i].i2c, ENABLE);
+    }
+}
+
+/*
+ * @brief i2c  ī б
+ * @param 
+ * @retval i2cErrorCount(uint16_t)
+ */
+uint16_t i2cGetErrorCounter(void)
+{
+    return i2cErrorCount;
 }
 
 /*
  * @brief i2c  ʱȭ
  * @note ʱ ÿ ߻ϴ     ϰ,    ߻ ȣ
+ * 		  SCL 8   start, stop ,  ܰ踶 I2C_UNSTICK_DELAY_US ٷ
  * @param i2cDevice: i2c ġ ü
- * @retval 
+ * @param phase:  ܰ, 0 ~ I2C_UNSTICK_PHASES - 1
+ * @retval ٸ ð(us),   AF ǵ 0
  */
-static void i2cUnstick(i2cDevice_t i2cDevice)
+static int32_t i2cUnstick(i2cDevice_t i2cDevice, uint8_t* phase)
 {
     GPIO_TypeDef *gpio;
     uint16_t scl, sda;
 
-    // prepare pins
     gpio = i2cHardwareMap[i2cDevice].gpio;
     scl = i2cHardwareMap[i2cDevice].scl;
     sda = i2cHardwareMap[i2cDevice].sda;
 
     GPIO_InitTypeDef GPIO_InitStructure;
-    GPIO_InitStructure.GPIO_Pin = scl | sda; //outod
-    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_OUT;
+    GPIO_InitStructure.GPIO_Pin = scl | sda;
     GPIO_InitStructure.GPIO_OType = GPIO_OType_OD;
     GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_NOPULL;
     GPIO_InitStructure.GPIO_Speed = GPIO_Speed_2MHz;
-    GPIO_Init(gpio, &GPIO_InitStructure);
 
-    digitalHi(gpio, scl | sda);
+    if (*phase == 0) {
+        // prepare pins, outod
+        GPIO_InitStructure.GPIO_Mode = GPIO_Mode_OUT;
+        GPIO_Init(gpio, &GPIO_InitStructure);
+        gpioSet(gpio, scl | sda);
+        *phase = 1;
+    }
 
-    uint8_t i = 0;
-    for (i = 0; i < 8; i++) {
-        // Wait for any clock stretching to finish
-        while (!digitalIn(gpio, scl)) {
-            i2cDelay();
+    if (*phase <= 16) {
+        if (*phase & 1) {
+            // Wait for any clock stretching to finish
+            if (!gpioRead(gpio, scl)) {
+                return I2C_UNSTICK_DELAY_US;
+            }
+            gpioClear(gpio, scl); // Pull low
+        }
+        else {
+            gpioSet(gpio, scl); // Release high again
         }
-        // Pull low
-        digitalLo(gpio, scl); // Set bus low
-        i2cDelay();
-        // Release high again
-        digitalHi(gpio, scl); // Set bus high
-        i2cDelay();
+        (*phase)++;
+        return I2C_UNSTICK_DELAY_US;
     }
 
     // Generate a start then stop condition
-    // SCL  PB10
-    // SDA  PB11
-    digitalLo(gpio, sda); // Set bus data low
-    i2cDelay();
-    digitalLo(gpio, scl); // Set bus scl low
-    i2cDelay();
-    digitalHi(gpio, scl); // Set bus scl high
-    i2cDelay();
-    digitalHi(gpio, sda); // Set bus sda high
-
-    // Init pins
-    GPIO_InitStructure.GPIO_Pin = scl | sda; //afod
-    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF;
-	GPIO_InitStructure.GPIO_OType = GPIO_OType_OD;
-	GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_NOPULL;
-	GPIO_InitStructure.GPIO_Speed = GPIO_Speed_2MHz;
-    GPIO_Init(gpio, &GPIO_InitStructure);
+    switch (*phase) {
+    case 17:
+        gpioClear(gpio, sda); // Set bus data low
+        break;
+    case 18:
+        gpioClear(gpio, scl); // Set bus scl low
+        break;
+    case 19:
+        gpioSet(gpio, scl); // Set bus scl high
+        break;
+    default:
+        gpioSet(gpio, sda); // Set bus sda high
+
+        // Init pins, afod
+        GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF;
+        GPIO_Init(gpio, &GPIO_InitStructure);
+        *phase = I2C_UNSTICK_PHASES;
+        return 0;
+    }
+    (*phase)++;
+    return I2C_UNSTICK_DELAY_US;
 }
 
 void I2C1_ER_IRQHandler(void)
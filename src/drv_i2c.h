@@ -1,6 +1,8 @@
 #ifndef _I2C_H_
 #define _I2C_H_
 
+#include <board.h>
+
 #ifndef bool
 typedef uint8_t bool;
 #define false (bool) 0
@@ -25,6 +27,9 @@ typedef struct i2cDevice_s {
     GPIO_TypeDef *gpio;
     uint16_t scl;
     uint16_t sda;
+    uint8_t sclPinSource;
+    uint8_t sdaPinSource;
+    uint8_t gpioAF;
     uint8_t evIrq;
     uint8_t erIrq;
     uint32_t gpioPeriph;
@@ -32,12 +37,9 @@ typedef struct i2cDevice_s {
 } i2cHardwareMap_t;
 
 /*
- * @brief Ÿ̸ ϵ 
+ * @brief i2c ϵ ,  board.h
  */
-static const i2cHardwareMap_t i2cHardwareMap[] = {
-    { I2C1, GPIOB, GPIO_Pin_6, GPIO_Pin_7, I2C1_EV_IRQn, I2C1_ER_IRQn, RCC_AHB1Periph_GPIOB, RCC_APB1Periph_I2C1 },
-    { I2C2, GPIOB, GPIO_Pin_10, GPIO_Pin_11, I2C2_EV_IRQn, I2C2_ER_IRQn, RCC_AHB1Periph_GPIOB, RCC_APB1Periph_I2C2 },
-};
+extern const i2cHardwareMap_t i2cHardwareMap[MAX_I2C_DEVICE];
 
 /*
  * @brief i2c ʱȭ Ÿ ü
@@ -50,8 +52,12 @@ typedef struct
 } i2cInitTypeDef_t;
 
 #define I2C_DEFAULT_TIMEOUT 3000
+#define I2C_UNSTICK_DELAY_US 10 //  Ǯ Ŭ ֱ
+#define I2C_UNSTICK_PHASES   21
 
 void i2cInit(i2cDevice_t i2cDevice, i2cInitTypeDef_t* i2cInitStruct);
+int32_t i2cInitStep(i2cDevice_t i2cDevice, i2cInitTypeDef_t* i2cInitStruct, uint8_t* phase);
+void i2cClockUpdate(void);
 void i2cStructInit(i2cInitTypeDef_t* i2cInitStruct);
 ErrorStatus i2cWriteBuffer(i2cDevice_t i2cDevice, uint8_t addr_, uint8_t reg_, uint8_t len_, uint8_t *data);
 ErrorStatus i2cWrite(i2cDevice_t i2cDevice, uint8_t addr_, uint8_t reg_, uint8_t data);
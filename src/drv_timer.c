@@ -0,0 +1,214 @@
+#include <stm32f4xx.h>
+#include <stm32f4xx_conf.h>
+#include <drv_timer.h>
+#include <profiler.h>
+
+/*
+ * @brief Ÿ̸ ä ϵ ,  ǿ ѹ 
+ */
+const timerHardwareMap_t timerHardwareMap[MAX_TIMER_DEVICE] = {
+	{ BOARD_TIMER1 }, { BOARD_TIMER2 }, { BOARD_TIMER3 }, { BOARD_TIMER4 }, { BOARD_TIMER5 }, { BOARD_TIMER6 },
+};
+
+/*
+ * @brief Էĸó ݹ Լ 迭
+ */
+static timerCaptureFuncPtr_t timerFuncPtr[MAX_TIMER_DEVICE];
+
+/*
+ * @brief ݹ鿡 Ѱ ä ȣ
+ */
+static uint8_t timerChannelMap[MAX_TIMER_DEVICE];
+
+/*
+ * @brief ʿ ĸó , ĸóҶ ؼ 
+ */
+static bool timerBothEdge[MAX_TIMER_DEVICE];
+
+/*
+ * @brief ŸӺ̽  ä ī ļ, Ŭ ٲ ֺ ٽ 
+ * @note  Ÿ̸Ӹ  ä ó ʱȭ äθ 0 ƴ
+ */
+static uint32_t timerTickHz[MAX_TIMER_DEVICE];
+
+/*
+ * @brief APB2  Ÿ̸ Ȯ
+ * @param tim: Ÿ̸ 
+ * @retval APB2 Ÿ̸Ӹ true
+ */
+bool timerIsApb2(TIM_TypeDef* tim) {
+	return (tim == TIM1 || tim == TIM8 || tim == TIM9 || tim == TIM10 || tim == TIM11);
+}
+
+/*
+ * @brief Ÿ̸ Է Ŭ 
+ * @note APB ֺ 1 ƴϸ Ÿ̸ Ŭ PCLK 2
+ * @param tim: Ÿ̸ 
+ * @retval Ÿ̸ Ŭ(Hz)
+ */
+uint32_t timerGetClock(TIM_TypeDef* tim) {
+	RCC_ClocksTypeDef clocks;
+	RCC_GetClocksFreq(&clocks);
+	const uint32_t pclk = timerIsApb2(tim) ? clocks.PCLK2_Frequency : clocks.PCLK1_Frequency;
+	return (pclk == clocks.HCLK_Frequency) ? pclk : pclk * 2;
+}
+
+/*
+ * @brief Ÿ̸ º ä ʱȭ
+ * @note ε带 ѹǷ CCR   Ʈ ̺Ʈ ݿ
+ * @param tim: Ÿ̸ 
+ * @param channel: TIM_Channel_x
+ * @param ocInitStruct: º ʱȭ ü 
+ * @retval 
+ */
+void timerOCInit(TIM_TypeDef* tim, uint16_t channel, TIM_OCInitTypeDef* ocInitStruct) {
+	switch(channel) {
+	case TIM_Channel_1:
+		TIM_OC1Init(tim, ocInitStruct);
+		TIM_OC1PreloadConfig(tim, TIM_OCPreload_Enable);
+		break;
+	case TIM_Channel_2:
+		TIM_OC2Init(tim, ocInitStruct);
+		TIM_OC2PreloadConfig(tim, TIM_OCPreload_Enable);
+		break;
+	case TIM_Channel_3:
+		TIM_OC3Init(tim, ocInitStruct);
+		TIM_OC3PreloadConfig(tim, TIM_OCPreload_Enable);
+		break;
+	case TIM_Channel_4:
+		TIM_OC4Init(tim, ocInitStruct);
+		TIM_OC4PreloadConfig(tim, TIM_OCPreload_Enable);
+		break;
+	}
+}
+
+/*
+ * @brief Ŭ ٲ  Էĸó ī ֺ ٽ 
+ * @note clockConfigure θ, ٷ ϹǷ ̴ ޽ ϳ Ʋ  
+ * @param 
+ * @retval 
+ */
+void timerClockUpdate(void) {
+	uint8_t i;
+	for(i = 0; i < MAX_TIMER_DEVICE; i++) {
+		if(timerTickHz[i] == 0) {
+			continue;
+		}
+		TIM_TypeDef* tim = timerHardwareMap[i].tim;
+		TIM_PrescalerConfig(tim, timerGetClock(tim) / timerTickHz[i] - 1, TIM_PSCReloadMode_Immediate);
+	}
+}
+
+/*
+ * @brief Ÿ̸ Էĸó ʱȭ
+ * @note  Ÿ̸ äγ ī͸ ϹǷ ó ʱȭҶ tickHz 
+ * 		   ð ϵ ĸó Ϳ ġǹǷ ͷƮ  
+ * @param timerDevice: Ÿ̸ ä ġ ü
+ * @param timerInitStruct: Էĸó ʱȭ  ü 
+ * @param timerFunc: ĸó ISR ȣ Լ 
+ * @param channel: ݹ鿡 Ѱ ä ȣ
+ * @retval 
+ */
+void timerCaptureInit(timerDevice_t timerDevice, timerInitTypeDef_t* timerInitStruct, timerCaptureFuncPtr_t timerFunc, uint8_t channel) {
+	const timerHardwareMap_t* map = &timerHardwareMap[timerDevice];
+
+	// clock Ȱȭ
+	RCC_AHB1PeriphClockCmd(map->gpioClock, ENABLE);
+	if(timerIsApb2(map->tim)) {
+		RCC_APB2PeriphClockCmd(map->timClock, ENABLE);
+	}
+	else {
+		RCC_APB1PeriphClockCmd(map->timClock, ENABLE);
+	}
+
+	// gpio 
+	GPIO_InitTypeDef GPIO_InitStructure;
+	GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF;
+	GPIO_InitStructure.GPIO_OType = GPIO_OType_PP;
+	GPIO_InitStructure.GPIO_Pin = map->pin;
+	GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_UP;
+	GPIO_InitStructure.GPIO_Speed = GPIO_Speed_25MHz;
+	GPIO_Init(map->gpio, &GPIO_InitStructure);
+	GPIO_PinAFConfig(map->gpio, map->pinSource, map->gpioAF);
+
+	// ȣ Լ , ͷƮ ѱ  ؾ
+	timerFuncPtr[timerDevice] = timerFunc;
+	timerChannelMap[timerDevice] = channel;
+	timerBothEdge[timerDevice] = (timerInitStruct->mode == TIMER_CAPTURE_BOTH_EDGE);
+
+	// ŸӺ̽ , ̹  Ÿ̸Ӹ ǳʶ
+	if((map->tim->CR1 & TIM_CR1_CEN) == 0) {
+		TIM_TimeBaseInitTypeDef TIM_TimeBaseStructure;
+		TIM_TimeBaseStructInit(&TIM_TimeBaseStructure);
+		TIM_TimeBaseStructure.TIM_Prescaler = timerGetClock(map->tim) / timerInitStruct->tickHz - 1;
+		TIM_TimeBaseStructure.TIM_Period = 0xffff;
+		TIM_TimeBaseStructure.TIM_ClockDivision = TIM_CKD_DIV1;
+		TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_Up;
+		TIM_TimeBaseInit(map->tim, &TIM_TimeBaseStructure);
+		timerTickHz[timerDevice] = timerInitStruct->tickHz;
+	}
+
+	// Էĸó , ʹ Ÿ̸ Ŭ 8(168MHz 100ns ) ª ۸ġ Ÿ
+	TIM_ICInitTypeDef TIM_ICInitStructure;
+	TIM_ICStructInit(&TIM_ICInitStructure);
+	TIM_ICInitStructure.TIM_Channel = map->channel;
+	TIM_ICInitStructure.TIM_ICPolarity = (timerInitStruct->mode == TIMER_CAPTURE_FALLING) ? TIM_ICPolarity_Falling : TIM_ICPolarity_Rising;
+	TIM_ICInitStructure.TIM_ICSelection = TIM_ICSelection_DirectTI;
+	TIM_ICInitStructure.TIM_ICPrescaler = TIM_ICPSC_DIV1;
+	TIM_ICInitStructure.TIM_ICFilter = 0x03;
+	TIM_ICInit(map->tim, &TIM_ICInitStructure);
+
+	// nvic 
+	NVIC_InitTypeDef NVIC_InitStructure;
+	NVIC_InitStructure.NVIC_IRQChannel = map->irq;
+	NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = timerInitStruct->preemptionPriority;
+	NVIC_InitStructure.NVIC_IRQChannelSubPriority = timerInitStruct->subPriority;
+	NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+	NVIC_Init(&NVIC_InitStructure);
+
+	TIM_ClearITPendingBit(map->tim, TIM_IT_CC1 << (map->channel >> 2));
+	TIM_ITConfig(map->tim, TIM_IT_CC1 << (map->channel >> 2), ENABLE);
+	TIM_Cmd(map->tim, ENABLE);
+}
+
+/*
+ * @brief Ÿ̸ ͷƮ ڵ鷯
+ * @note ش Ÿ̸Ӹ  äε 鼭 ĸó ÷װ  ä ݹ ȣ
+ * 		  ʿ  ؼ Ʈ ̹ ĸó   ˾Ƴ  ؼ 
+ * @param tim: ͷƮ ߻ Ÿ̸
+ * @retval 
+ */
+static void timerHandler(TIM_TypeDef* tim) {
+	PROFILE_ENTER();
+	const uint16_t status = tim->SR & tim->DIER;
+	uint8_t i;
+	for(i = 0; i < MAX_TIMER_DEVICE; i++) {
+		if(timerHardwareMap[i].tim != tim) {
+			continue;
+		}
+		const uint8_t index = timerHardwareMap[i].channel >> 2; // 0 ~ 3, CC1 ~ CC4
+		const uint16_t flag = TIM_IT_CC1 << index;
+		if((status & flag) == 0) {
+			continue;
+		}
+		tim->SR = (uint16_t)~(flag | (TIM_FLAG_CC1OF << index)); // ĸó, ĸó ÷ clear
+		const uint16_t capture = (&tim->CCR1)[index]; // CCR1 ~ CCR4 ӵ ּ
+		const uint16_t polarity = TIM_CCER_CC1P << (index * 4);
+		const bool rising = (tim->CCER & polarity) == 0;
+		if(timerBothEdge[i] == true) {
+			tim->CCER ^= polarity;
+		}
+		if(timerFuncPtr[i] != NULL) {
+			timerFuncPtr[i](timerChannelMap[i], capture, rising);
+		}
+	}
+	PROFILE_EXIT(PROF_TIMER);
+}
+
+void TIM3_IRQHandler(void) {
+	timerHandler(TIM3);
+}
+
+void TIM8_BRK_TIM12_IRQHandler(void) {
+	timerHandler(TIM12);
+}
@@ -0,0 +1,79 @@
+#ifndef _TIMER_H_
+#define _TIMER_H_
+
+#include <stm32f4xx.h>
+#include <stm32f4xx_conf.h>
+#include <board.h>
+
+#ifndef bool
+typedef uint8_t bool;
+#define false (bool) 0
+#define true (bool) 1
+#define NULL ((void *)0)
+#endif
+
+/*
+ * @brief Ÿ̸ ä ġ ü
+ */
+typedef enum {
+	TIMER_DEVICE_1 = 0,
+	TIMER_DEVICE_2,
+	TIMER_DEVICE_3,
+	TIMER_DEVICE_4,
+	TIMER_DEVICE_5,
+	TIMER_DEVICE_6,
+	MAX_TIMER_DEVICE,
+} timerDevice_t;
+
+/*
+ * @brief Ÿ̸ ä ϵ Ÿ ü
+ */
+typedef struct {
+	TIM_TypeDef *tim;
+	GPIO_TypeDef *gpio;
+	uint16_t pin;
+	uint8_t pinSource;
+	uint16_t channel; // TIM_Channel_x
+	uint8_t irq;
+	uint32_t gpioClock;
+	uint32_t timClock;
+	uint8_t gpioAF;
+} timerHardwareMap_t;
+
+/*
+ * @brief Ÿ̸ ä ϵ ,  board.h
+ */
+extern const timerHardwareMap_t timerHardwareMap[MAX_TIMER_DEVICE];
+
+/*
+ * @brief Էĸó  ü
+ */
+typedef enum {
+	TIMER_CAPTURE_RISING = 0,
+	TIMER_CAPTURE_FALLING,
+	TIMER_CAPTURE_BOTH_EDGE, // ĸóҶ ̹ ؼ 
+} timerCaptureMode_t;
+
+/*
+ * @brief Ÿ̸ Էĸó ʱȭ Ÿ ü
+ */
+typedef struct {
+	uint8_t preemptionPriority;
+	uint8_t subPriority;
+	uint32_t tickHz; // ī ļ, 1000000̸ 1us
+	timerCaptureMode_t mode;
+} timerInitTypeDef_t;
+
+/*
+ * @brief Էĸó ݹ Լ
+ * @note : Ҷ ѱ ä ȣ, ĸó  , ¿ 
+ */
+typedef void (*timerCaptureFuncPtr_t) (uint8_t, uint16_t, bool);
+
+void timerCaptureInit(timerDevice_t timerDevice, timerInitTypeDef_t* timerInitStruct, timerCaptureFuncPtr_t timerFunc, uint8_t channel);
+uint32_t timerGetClock(TIM_TypeDef* tim);
+void timerClockUpdate(void);
+bool timerIsApb2(TIM_TypeDef* tim);
+void timerOCInit(TIM_TypeDef* tim, uint16_t channel, TIM_OCInitTypeDef* ocInitStruct);
+
+#endif
@@ -1,9 +1,44 @@
 #include <stm32f4xx.h>
 #include <stm32f4xx_conf.h>
 #include <drv_uart.h>
+#include <system.h>
+#include <profiler.h>
 
-static volatile uartBuf_t uartBuf[MAX_UART_DEVICE];
+static volatile uartBuf_t uartBuf[MAX_UART_DEVICE]; //  DMA Ƿ SRAM ־, CCM 
 static USART_TypeDef* uartPeriph[MAX_UART_DEVICE];
+static DMA_Stream_TypeDef* uartRxDma[MAX_UART_DEVICE]; // DMA   NULL
+static volatile uint32_t uartIdleTime[MAX_UART_DEVICE]; //   idle ð(cycles)
+static uint32_t uartBaudRate[MAX_UART_DEVICE]; // ʱȭ  ġ 0, Ŭ ٲ ٽ 
+
+
+/*
+ * @brief Ʈ ϵ ,  ǿ ѹ 
+ */
+const uartHardwareMap_t uartHardwareMap[MAX_UART_DEVICE] = {
+	{ BOARD_UART1 }, { BOARD_UART2 }, { BOARD_UART3 }, { BOARD_UART4 }, { BOARD_UART5 }, { BOARD_UART6 },
+};
+const uartDmaHardwareMap_t uartDmaHardwareMap[MAX_UART_DEVICE] = {
+	{ BOARD_UART1_DMA }, { BOARD_UART2_DMA }, { BOARD_UART3_DMA }, { BOARD_UART4_DMA }, { BOARD_UART5_DMA }, { BOARD_UART6_DMA },
+};
+const uartInverterMap_t uartInverterMap[MAX_UART_DEVICE] = {
+	{ BOARD_UART1_INVERTER }, { BOARD_UART2_INVERTER }, { BOARD_UART3_INVERTER }, { BOARD_UART4_INVERTER }, { BOARD_UART5_INVERTER }, { BOARD_UART6_INVERTER },
+};
+
+/*
+ * @brief Ʈ ʱȭ ü ⺻
+ * @note 115200 8N1,  , ͷƮ 
+ * @param uartInitStruct: Ʈ ʱȭ  ü 
+ * @retval 
+ */
+void uartStructInit(uartInitTypeDef_t* uartInitStruct) {
+	uartInitStruct->preemptionPriority = 0;
+	uartInitStruct->subPriority = 1;
+	uartInitStruct->baudRate = 115200;
+	uartInitStruct->parity = USART_Parity_No;
+	uartInitStruct->stopBits = USART_StopBits_1;
+	uartInitStruct->inverted = false;
+	uartInitStruct->rxDma = false;
+}
 
 /*
  * @brief Ʈ ʱȭ
@@ -40,14 +75,60 @@ void uartInit(uartDevice_t uartDevice, uartInitTypeDef_t* uartInitStruct) {
 	USART_InitTypeDef USART_InitStructure;
 
 	USART_InitStructure.USART_BaudRate = uartInitStruct->baudRate;
-	USART_InitStructure.USART_WordLength = USART_WordLength_8b;
-	USART_InitStructure.USART_StopBits = USART_StopBits_1;
-	USART_InitStructure.USART_Parity = USART_Parity_No ;
+	USART_InitStructure.USART_WordLength = (uartInitStruct->parity == USART_Parity_No) ? USART_WordLength_8b : USART_WordLength_9b; // иƼ Ʈ  
+	USART_InitStructure.USART_StopBits = uartInitStruct->stopBits;
+	USART_InitStructure.USART_Parity = uartInitStruct->parity;
 	USART_InitStructure.USART_HardwareFlowControl = USART_HardwareFlowControl_None;
 	USART_InitStructure.USART_Mode = USART_Mode_Rx | USART_Mode_Tx;
 	USART_Init(uartHardwareMap[uartDevice].uart, &USART_InitStructure);
+	uartBaudRate[uartDevice] = uartInitStruct->baudRate;
+
+	//  ȸ 
+	if(uartInverterMap[uartDevice].gpio != 0) {
+		RCC_AHB1PeriphClockCmd(uartInverterMap[uartDevice].gpioClock, ENABLE);
+		GPIO_InitStructure.GPIO_Pin = uartInverterMap[uartDevice].pin;
+		GPIO_InitStructure.GPIO_Mode = GPIO_Mode_OUT;
+		GPIO_InitStructure.GPIO_Speed = GPIO_Speed_2MHz;
+		GPIO_Init(uartInverterMap[uartDevice].gpio, &GPIO_InitStructure);
+		if(uartInitStruct->inverted == true) {
+			GPIO_SetBits(uartInverterMap[uartDevice].gpio, uartInverterMap[uartDevice].pin);
+		}
+		else {
+			GPIO_ResetBits(uartInverterMap[uartDevice].gpio, uartInverterMap[uartDevice].pin);
+		}
+	}
+
+	if(uartInitStruct->rxDma == true) {
+		//   ü ȯ DMA ä,  ġ NDTR 
+		const uartDmaHardwareMap_t* dma = &uartDmaHardwareMap[uartDevice];
+		RCC_AHB1PeriphClockCmd(dma->dmaClock, ENABLE);
+		DMA_DeInit(dma->rxStream);
 
-	USART_ITConfig(uartHardwareMap[uartDevice].uart, USART_IT_RXNE, ENABLE);
+		DMA_InitTypeDef DMA_InitStructure;
+		DMA_StructInit(&DMA_InitStructure);
+		DMA_InitStructure.DMA_Channel = dma->rxChannel;
+		DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)(uintptr_t)&uartHardwareMap[uartDevice].uart->DR;
+		DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t)(uintptr_t)uartBuf[uartDevice].RX.Buf;
+		DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralToMemory;
+		DMA_InitStructure.DMA_BufferSize = BUFFER_SIZE;
+		DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+		DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+		DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+		DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+		DMA_InitStructure.DMA_Mode = DMA_Mode_Circular;
+		DMA_InitStructure.DMA_Priority = DMA_Priority_High;
+		DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Disable;
+		DMA_Init(dma->rxStream, &DMA_InitStructure);
+		DMA_Cmd(dma->rxStream, ENABLE);
+
+		USART_DMACmd(uartHardwareMap[uartDevice].uart, USART_DMAReq_Rx, ENABLE);
+		USART_ITConfig(uartHardwareMap[uartDevice].uart, USART_IT_IDLE, ENABLE); //   ð Ͽ
+		uartRxDma[uartDevice] = dma->rxStream;
+	}
+	else {
+		USART_ITConfig(uartHardwareMap[uartDevice].uart, USART_IT_RXNE, ENABLE);
+		uartRxDma[uartDevice] = NULL;
+	}
 
 	NVIC_InitTypeDef NVIC_InitStructure;
 	NVIC_InitStructure.NVIC_IRQChannel = uartHardwareMap[uartDevice].irq;
@@ -59,6 +140,40 @@ void uartInit(uartDevice_t uartDevice, uartInitTypeDef_t* uartInitStruct) {
 	USART_Cmd(uartHardwareMap[uartDevice].uart, ENABLE);
 }
 
+/*
+ * @brief Ŭ ٲ  Ʈ ٽ 
+ * @note 16 ø̹Ƿ BRR = PCLK / Ʈ(ݿø), clockConfigure θ
+ * @param 
+ * @retval 
+ */
+void uartClockUpdate(void) {
+	RCC_ClocksTypeDef clocks;
+	RCC_GetClocksFreq(&clocks);
+	uint8_t i;
+	for(i = 0; i < MAX_UART_DEVICE; i++) {
+		if(uartBaudRate[i] == 0) {
+			continue;
+		}
+		USART_TypeDef* uart = uartHardwareMap[i].uart;
+		const uint32_t pclk = (uart == USART1 || uart == USART6) ? clocks.PCLK2_Frequency : clocks.PCLK1_Frequency;
+		uart->BRR = (uint16_t)((pclk + uartBaudRate[i] / 2) / uartBaudRate[i]);
+	}
+}
+
+/*
+ * @brief Ʈ    ġ
+ * @note DMA ̸ DMA    
+ * @param uartDevice: Ʈ ġ ü
+ * @retval   head
+ */
+static uint16_t uartRxHead(uartDevice_t uartDevice)
+{
+	if(uartRxDma[uartDevice] != NULL) {
+		return (BUFFER_SIZE - DMA_GetCurrDataCounter(uartRxDma[uartDevice])) % BUFFER_SIZE;
+	}
+	return uartBuf[uartDevice].RX.BufHead;
+}
+
 /*
  * @brief Ʈ  
  * @param uartDevice: Ʈ ġ ü
@@ -78,6 +193,45 @@ void uartPutChar (uartDevice_t uartDevice, uint8_t c)
 	USART_ITConfig(UARTx, USART_IT_TXE, ENABLE);
 }
 
+/*
+ * @brief Ʈ ̳ʸ 
+ * @note uartPutChar ޸ '\n' ȯ 
+ * @param uartDevice: Ʈ ġ ü
+ * @param data:   
+ * @param len:  Ʈ 
+ * @retval 
+ */
+void uartWrite(uartDevice_t uartDevice, const uint8_t* data, uint16_t len)
+{
+	USART_TypeDef* UARTx = uartPeriph[uartDevice];
+	while(len--) {
+		uartBuf[uartDevice].TX.Buf[uartBuf[uartDevice].TX.BufHead++] = *data++;
+		uartBuf[uartDevice].TX.BufHead %= BUFFER_SIZE;
+	}
+	USART_ITConfig(UARTx, USART_IT_TXE, ENABLE);
+}
+
+/*
+ * @brief Ʈ  ۿ  Ʈ 
+ * @param uartDevice: Ʈ ġ ü
+ * @retval Ʈ (uint16_t)
+ */
+uint16_t uartAvailable(uartDevice_t uartDevice)
+{
+	return (uartRxHead(uartDevice) - uartBuf[uartDevice].RX.BufTail + BUFFER_SIZE) % BUFFER_SIZE;
+}
+
+/*
+ * @brief   idle ð
+ * @note DMA ϶ ŵ,  Ʈ ް   ð ڿ ϵ
+ * @param uartDevice: Ʈ ġ ü
+ * @retval ð(cycles)
+ */
+uint32_t uartGetIdleTime(uartDevice_t uartDevice)
+{
+	return uartIdleTime[uartDevice];
+}
+
 /*
  * @brief Ʈ  б
  * @param uartDevice: Ʈ ġ ü
@@ -86,7 +240,7 @@ void uartPutChar (uartDevice_t uartDevice, uint8_t c)
 uint8_t uartGetChar(uartDevice_t uartDevice)
 {
 	uint8_t buf;
-	if(uartBuf[uartDevice].RX.BufHead == uartBuf[uartDevice].RX.BufTail)
+	if(uartRxHead(uartDevice) == uartBuf[uartDevice].RX.BufTail)
 	{
 		buf = '?';
 	}
@@ -104,12 +258,18 @@ uint8_t uartGetChar(uartDevice_t uartDevice)
  * @retval 
  */
 void uartHandler(uartDevice_t uartDevice) {
+	PROFILE_ENTER();
 	USART_TypeDef* UARTx = uartPeriph[uartDevice];
 	if(USART_GetITStatus(UARTx, USART_IT_RXNE) != RESET)
 	{
 		uartBuf[uartDevice].RX.Buf[uartBuf[uartDevice].RX.BufHead++] = USART_ReceiveData(UARTx);
 		uartBuf[uartDevice].RX.BufHead %= BUFFER_SIZE;
 	}
+	if(USART_GetITStatus(UARTx, USART_IT_IDLE) != RESET)
+	{
+		uartIdleTime[uartDevice] = cycles();
+		USART_ReceiveData(UARTx); // SR  DR о IDLE ÷װ clear
+	}
 	if(USART_GetITStatus(UARTx, USART_IT_TXE) != RESET)
 	{
 		USART_SendData(UARTx, uartBuf[uartDevice].TX.Buf[uartBuf[uartDevice].TX.BufTail++]);
@@ -119,6 +279,7 @@ void uartHandler(uartDevice_t uartDevice) {
 			USART_ITConfig(UARTx, USART_IT_TXE, DISABLE);
 		}
 	}
+	PROFILE_EXIT(PROF_UART);
 }
 
 void USART1_IRQHandler(void)
@@ -1,8 +1,17 @@
 #ifndef _UART_H_
 #define _UART_H_
 
+#include <board.h>
+
 #define BUFFER_SIZE       2048
 
+#ifndef bool
+typedef uint8_t bool;
+#define false (bool) 0
+#define true (bool) 1
+#define NULL ((void *)0)
+#endif
+
 /*
  * @brief Ʈ ġ ü
  */
@@ -31,18 +40,38 @@ typedef struct {
 } uartHardwareMap_t;
 
 /*
- * @brief Ʈ ϵ 
+ * @brief Ʈ ϵ ,  board.h
+ */
+extern const uartHardwareMap_t uartHardwareMap[MAX_UART_DEVICE];
+
+/*
+ * @brief Ʈ  DMA ϵ   ü
+ */
+typedef struct {
+	DMA_Stream_TypeDef *rxStream;
+	uint32_t rxChannel;
+	uint32_t dmaClock;
+} uartDmaHardwareMap_t;
+
+/*
+ * @brief Ʈ  DMA ϵ ,  board.h
+ */
+extern const uartDmaHardwareMap_t uartDmaHardwareMap[MAX_UART_DEVICE];
+
+/*
+ * @brief Ʈ ȣ  ȸ  Ÿ ü
+ */
+typedef struct {
+	GPIO_TypeDef *gpio;
+	uint16_t pin;
+	uint32_t gpioClock;
+} uartInverterMap_t;
+
+/*
+ * @brief Ʈ ȣ  ȸ  ,  board.h
+ * @note F4 USART    Ƿ 忡  ȸ   ä, 0̸  
  */
-static const uartHardwareMap_t uartHardwareMap[] = {
-    { USART1, GPIOA, 9, 10, USART1_IRQn, RCC_AHB1Periph_GPIOA, RCC_APB2Periph_USART1, GPIO_AF_USART1 },
-//    { USART1, GPIOB, 6, 7, USART1_IRQn, RCC_AHB1Periph_GPIOB, RCC_APB2Periph_USART1, GPIO_AF_USART1 },
-    { USART2, GPIOA, 2, 3, USART2_IRQn, RCC_AHB1Periph_GPIOA, RCC_APB1Periph_USART2, GPIO_AF_USART2 },
-    { USART3, GPIOC, 10, 11, USART3_IRQn, RCC_AHB1Periph_GPIOC, RCC_APB1Periph_USART3, GPIO_AF_USART3 },
-    { UART4, GPIOA, 0, 1, UART4_IRQn, RCC_AHB1Periph_GPIOA, RCC_APB1Periph_UART4, GPIO_AF_UART4 },
-//    { UART4, GPIOC, 10, 11, UART4_IRQn, RCC_AHB1Periph_GPIOC, RCC_APB1Periph_UART4, GPIO_AF_UART4 },
-    { UART5, 0, 0, 0, 0, 0, 0, 0 }, //   Ʈ  ʾƼ  ʱȭ Լδ ʱȭ Ұ
-    { USART6, GPIOC, 6, 7, USART6_IRQn, RCC_AHB1Periph_GPIOC, RCC_APB2Periph_USART6, GPIO_AF_USART6 },
-};
+extern const uartInverterMap_t uartInverterMap[MAX_UART_DEVICE];
 
 /*
  * @brief Ʈ ʱȭ Ÿ ü
@@ -51,6 +80,10 @@ typedef struct {
 	uint8_t preemptionPriority;
 	uint8_t subPriority;
 	uint32_t baudRate;
+	uint16_t parity;   // USART_Parity_No, USART_Parity_Even, USART_Parity_Odd
+	uint16_t stopBits; // USART_StopBits_1, USART_StopBits_2
+	bool inverted;     // ȣ , uartInverterMap   
+	bool rxDma;        //  DMA ȯ ۷ , Ʈ ͷƮ ɸ 
 } uartInitTypeDef_t;
 
 /*
@@ -67,8 +100,13 @@ typedef struct {
 	}TX;
 }uartBuf_t;
 
+void uartStructInit(uartInitTypeDef_t* uartInitStruct);
 void uartInit(uartDevice_t uartDevice, uartInitTypeDef_t* uartInitStruct);
+void uartClockUpdate(void);
 void uartPutChar (uartDevice_t uartChan, uint8_t c);
 uint8_t uartGetChar(uartDevice_t uartChan);
+void uartWrite(uartDevice_t uartDevice, const uint8_t* data, uint16_t len);
+uint16_t uartAvailable(uartDevice_t uartDevice);
+uint32_t uartGetIdleTime(uartDevice_t uartDevice);
 
 #endif
@@ -0,0 +1,506 @@
+#include <stm32f4xx.h>
+#include <stm32f4xx_conf.h>
+#include <drv_timer.h>
+#include <profiler.h>
+#include <motor.h>
+#include <dshot.h>
+#include <ccm.h>
+
+#define DSHOT_CCMR_INPUT   TIM_CCMR1_CC1S_0 // CCxS = 01, TIx  Է
+#define DSHOT_CCER_INPUT   (TIM_CCER_CC1E | TIM_CCER_CC1P | TIM_CCER_CC1NP) // ʿ ĸó
+
+/*
+ * @brief ӵ Ʈ ļ(kHz)
+ */
+static const uint16_t dshotBitRate[] = { 150, 300, 600 };
+
+/*
+ * @brief GCR 5Ʈ -> 4Ʈ ȯǥ, 0xff  ʴ ڵ
+ */
+static const uint8_t dshotGcrTable[32] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x09, 0x0a, 0x0b, 0xff, 0x0d, 0x0e, 0x0f,
+	0xff, 0xff, 0x02, 0x03, 0xff, 0x05, 0x06, 0x07, 0xff, 0x00, 0x08, 0x01, 0xff, 0x04, 0x0c, 0xff,
+};
+
+/*
+ * @brief Ÿ̸Ӻ DMA ۿ 
+ * @note DMA Ƿ SRAM ־, CCM 
+ * 		  ۴ Ʈ  CCR1 ~ CCR4  徿, Ʈ ̺Ʈ DMAR  (burst) 
+ */
+static struct {
+	const motorHardwareMap_t* map; //  Ÿ̸Ӹ  ù ä 
+	uint32_t buf[DSHOT_DMA_LENGTH];
+	volatile bool capturing; //     ޴
+} dshotTimer[DSHOT_TIMER_MAX];
+static uint8_t dshotTimerCount = 0;
+static uint8_t dshotMotorTimer[MOTOR_MAX]; // ͺ Ÿ̸ ȣ
+static uint8_t dshotMotorCount = 0;
+static bool dshotBidir = false;
+
+/*
+ * @brief   ͺ 
+ * @note dshotEdge ĸó DMA Ƿ SRAM,  CPU 
+ */
+static uint16_t dshotEdge[MOTOR_MAX][DSHOT_TELEMETRY_EDGES]; //   ĸó
+static uint8_t dshotCcmrOutput[MOTOR_MAX]; //  ǵ  CCMR 
+static uint32_t dshotErpm[MOTOR_MAX] CCM_BSS;
+static dshotTelemetryStat_t dshotStat[MOTOR_MAX] CCM_BSS;
+
+/*
+ * @brief ä CCMR  Ϳ Ʈ ġ
+ * @note CCMR1(CH1, CH2), CCMR2(CH3, CH4) ӵ ּ, äθ 8Ʈ
+ */
+#define DSHOT_CCMR(tim, index)   ((&(tim)->CCMR1)[(index) >> 1])
+#define DSHOT_CCMR_SHIFT(index)  (((index) & 1) * 8)
+
+/*
+ * @brief ä Էĸó ٲٰ ĸó DMA 
+ * @note CCxS ä     Ƿ CCxE  
+ * @param motor:  ȣ
+ * @retval 
+ */
+static void dshotChannelInput(uint8_t motor) {
+	const motorHardwareMap_t* map = &motorHardwareMap[motor];
+	TIM_TypeDef* tim = map->tim;
+	const uint8_t index = map->channel >> 2;
+
+	tim->CCER &= ~(0x0f << (index * 4));
+	DSHOT_CCMR(tim, index) = (DSHOT_CCMR(tim, index) & ~(0xff << DSHOT_CCMR_SHIFT(index))) | (DSHOT_CCMR_INPUT << DSHOT_CCMR_SHIFT(index));
+	tim->CCER |= DSHOT_CCER_INPUT << (index * 4);
+
+	DMA_ClearFlag(map->captureDmaStream, map->captureDmaFlag);
+	map->captureDmaStream->NDTR = DSHOT_TELEMETRY_EDGES;
+	map->captureDmaStream->CR |= DMA_SxCR_EN;
+	tim->DIER |= TIM_DIER_CC1DE << index;
+}
+
+/*
+ * @brief ĸó DMA ߰  ؼ, ä ٽ 
+ * @param motor:  ȣ
+ * @retval 
+ */
+static void dshotChannelOutput(uint8_t motor) {
+	const motorHardwareMap_t* map = &motorHardwareMap[motor];
+	TIM_TypeDef* tim = map->tim;
+	const uint8_t index = map->channel >> 2;
+
+	tim->DIER &= ~(TIM_DIER_CC1DE << index);
+	map->captureDmaStream->CR &= ~DMA_SxCR_EN;
+	while(map->captureDmaStream->CR & DMA_SxCR_EN);
+
+	const uint8_t count = DSHOT_TELEMETRY_EDGES - map->captureDmaStream->NDTR;
+	if(count == 0) {
+		dshotStat[motor].timeoutCount++;
+	}
+	else {
+		const uint32_t erpm = dshotDecode(dshotEdge[motor], count);
+		if(erpm == DSHOT_TELEMETRY_INVALID) {
+			dshotStat[motor].errorCount++;
+		}
+		else {
+			dshotErpm[motor] = erpm;
+			dshotStat[motor].frameCount++;
+		}
+	}
+
+	tim->CCER &= ~(0x0f << (index * 4));
+	DSHOT_CCMR(tim, index) = (DSHOT_CCMR(tim, index) & ~(0xff << DSHOT_CCMR_SHIFT(index))) | (dshotCcmrOutput[motor] << DSHOT_CCMR_SHIFT(index));
+	tim->CCER |= (TIM_CCER_CC1E | TIM_CCER_CC1P) << (index * 4); //   
+}
+
+/*
+ * @brief board.h ۿϷ ͷƮ ڵ鷯 ǵ stream
+ * @param stream: Ʈ DMA stream
+ * @retval ڵ鷯  true
+ */
+static bool dshotDmaHasHandler(const DMA_Stream_TypeDef* stream) {
+	const DMA_Stream_TypeDef* const streams[] = {
+#ifdef BOARD_DSHOT_DMA1_IRQHandler
+		BOARD_FIELD(0, BOARD_DSHOT_DMA1),
+#endif
+#ifdef BOARD_DSHOT_DMA2_IRQHandler
+		BOARD_FIELD(0, BOARD_DSHOT_DMA2),
+#endif
+		NULL,
+	};
+	uint8_t i;
+	for(i = 0; streams[i] != NULL; i++) {
+		if(streams[i] == stream) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/*
+ * @brief DShot ʱȭ
+ * @note Ÿ̸ Ѱ  ä  Ʈ DMA  Ʈ 
+ * 		    ȣ ( high)ǰ,     Էĸó ٲ eRPM  
+ * @param type: DShot ӵ ü
+ * @param motorCount:  , MOTOR_MAX 
+ * @param bidir: (eRPM ڷƮ)  
+ * @retval 
+ */
+void dshotInit(dshotType_t type, uint8_t motorCount, bool bidir) {
+	uint8_t i, j;
+	dshotMotorCount = motorCount;
+	dshotTimerCount = 0;
+	dshotBidir = bidir;
+	for(i = 0; i < motorCount; i++) {
+		const motorHardwareMap_t* map = &motorHardwareMap[i];
+
+		// Ÿ̸ ,  ۿϷ ͷƮ ڵ鷯 ִ stream
+		for(j = 0; j < dshotTimerCount && dshotTimer[j].map->tim != map->tim; j++);
+		if(j == dshotTimerCount) {
+			if(dshotTimerCount >= DSHOT_TIMER_MAX || (bidir && dshotDmaHasHandler(map->dmaStream) == false)) {
+				dshotMotorCount = i;
+				break;
+			}
+			dshotTimer[j].map = map;
+			dshotTimer[j].capturing = false;
+			dshotTimerCount++;
+		}
+		dshotMotorTimer[i] = j;
+
+		// clock Ȱȭ
+		RCC_AHB1PeriphClockCmd(map->gpioClock, ENABLE);
+		if(timerIsApb2(map->tim)) {
+			RCC_APB2PeriphClockCmd(map->timClock, ENABLE);
+		}
+		else {
+			RCC_APB1PeriphClockCmd(map->timClock, ENABLE);
+		}
+
+		// gpio ,  ESC   high α  Ǯ
+		GPIO_InitTypeDef GPIO_InitStructure;
+		GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF;
+		GPIO_InitStructure.GPIO_OType = GPIO_OType_PP;
+		GPIO_InitStructure.GPIO_Pin = map->pin;
+		GPIO_InitStructure.GPIO_PuPd = bidir ? GPIO_PuPd_UP : GPIO_PuPd_DOWN;
+		GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
+		GPIO_Init(map->gpio, &GPIO_InitStructure);
+		GPIO_PinAFConfig(map->gpio, map->pinSource, map->gpioAF);
+
+		// º , CCR 0̸ Ȱ 
+		TIM_OCInitTypeDef TIM_OCInitStructure;
+		TIM_OCStructInit(&TIM_OCInitStructure);
+		TIM_OCInitStructure.TIM_OCMode = TIM_OCMode_PWM1;
+		TIM_OCInitStructure.TIM_OutputState = TIM_OutputState_Enable;
+		TIM_OCInitStructure.TIM_OutputNState = TIM_OutputNState_Disable;
+		TIM_OCInitStructure.TIM_OCPolarity = bidir ? TIM_OCPolarity_Low : TIM_OCPolarity_High;
+		TIM_OCInitStructure.TIM_OCIdleState = TIM_OCIdleState_Reset;
+		TIM_OCInitStructure.TIM_Pulse = 0;
+		timerOCInit(map->tim, map->channel, &TIM_OCInitStructure);
+
+		const uint8_t index = map->channel >> 2;
+		dshotCcmrOutput[i] = DSHOT_CCMR(map->tim, index) >> DSHOT_CCMR_SHIFT(index);
+
+		if(bidir) {
+			// ĸó dma ,  CCRx  ۷
+			RCC_AHB1PeriphClockCmd(map->dmaClock, ENABLE);
+			DMA_DeInit(map->captureDmaStream);
+			DMA_InitTypeDef DMA_InitStructure;
+			DMA_StructInit(&DMA_InitStructure);
+			DMA_InitStructure.DMA_Channel = map->captureDmaChannel;
+			DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)(uintptr_t)&(&map->tim->CCR1)[index];
+			DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t)(uintptr_t)dshotEdge[i];
+			DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralToMemory;
+			DMA_InitStructure.DMA_BufferSize = DSHOT_TELEMETRY_EDGES;
+			DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+			DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+			DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_HalfWord;
+			DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_HalfWord;
+			DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+			DMA_InitStructure.DMA_Priority = DMA_Priority_High;
+			DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Disable;
+			DMA_Init(map->captureDmaStream, &DMA_InitStructure);
+		}
+		dshotErpm[i] = 0;
+		dshotStat[i].frameCount = 0;
+		dshotStat[i].errorCount = 0;
+		dshotStat[i].timeoutCount = 0;
+	}
+
+	for(j = 0; j < dshotTimerCount; j++) {
+		const motorHardwareMap_t* map = dshotTimer[j].map;
+
+		// ŸӺ̽ ,  Ʈ DSHOT_BIT_LENGTH ƽ
+		TIM_TimeBaseInitTypeDef TIM_TimeBaseStructure;
+		TIM_TimeBaseStructInit(&TIM_TimeBaseStructure);
+		TIM_TimeBaseStructure.TIM_Prescaler = dshotPrescaler(timerGetClock(map->tim), type);
+		TIM_TimeBaseStructure.TIM_Period = DSHOT_BIT_LENGTH - 1;
+		TIM_TimeBaseStructure.TIM_ClockDivision = TIM_CKD_DIV1;
+		TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_Up;
+		TIM_TimeBaseInit(map->tim, &TIM_TimeBaseStructure);
+		TIM_ARRPreloadConfig(map->tim, ENABLE);
+
+		// dma , Ʈ ̺Ʈ CCR1  
+		RCC_AHB1PeriphClockCmd(map->dmaClock, ENABLE);
+		DMA_DeInit(map->dmaStream);
+		DMA_InitTypeDef DMA_InitStructure;
+		DMA_StructInit(&DMA_InitStructure);
+		DMA_InitStructure.DMA_Channel = map->dmaChannel;
+		DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)(uintptr_t)&map->tim->DMAR;
+		DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t)(uintptr_t)dshotTimer[j].buf;
+		DMA_InitStructure.DMA_DIR = DMA_DIR_MemoryToPeripheral;
+		DMA_InitStructure.DMA_BufferSize = DSHOT_DMA_LENGTH;
+		DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+		DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+		DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Word;
+		DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Word;
+		DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+		DMA_InitStructure.DMA_Priority = DMA_Priority_High;
+		DMA_InitStructure.DMA_FIFOMode = DMA_FIFOMode_Disable;
+		DMA_Init(map->dmaStream, &DMA_InitStructure);
+
+		//    ͷƮ Է ٲ
+		if(bidir) {
+			NVIC_InitTypeDef NVIC_InitStructure;
+			NVIC_InitStructure.NVIC_IRQChannel = map->dmaIrq;
+			NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = DSHOT_NVIC_PRIORITY;
+			NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+			NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+			NVIC_Init(&NVIC_InitStructure);
+			DMA_ITConfig(map->dmaStream, DMA_IT_TC, ENABLE);
+		}
+
+		TIM_DMAConfig(map->tim, TIM_DMABase_CCR1, TIM_DMABurstLength_4Transfers);
+		TIM_DMACmd(map->tim, TIM_DMA_Update, ENABLE);
+		if(map->tim == TIM1 || map->tim == TIM8) {
+			TIM_CtrlPWMOutputs(map->tim, ENABLE);
+		}
+		TIM_Cmd(map->tim, ENABLE);
+	}
+
+	for(i = 0; i < dshotMotorCount; i++) {
+		dshotWrite(i, 0);
+	}
+}
+
+/*
+ * @brief Ÿ̸ Ϸ 
+ * @note  Ʈ DSHOT_BIT_LENGTH ƽ ǵ , 168MHz(APB2) 84MHz(APB1) Ÿ̸ Ŭ  ӵ   
+ * @param timerClock: Ÿ̸ Է Ŭ(Hz)
+ * @param type: DShot ӵ ü
+ * @retval TIM_Prescaler  
+ */
+uint16_t dshotPrescaler(uint32_t timerClock, dshotType_t type) {
+	return timerClock / ((uint32_t)dshotBitRate[type] * 1000 * DSHOT_BIT_LENGTH) - 1;
+}
+
+/*
+ * @brief DShot Ŷ 
+ * @note (11Ʈ), ڷƮ û(1Ʈ), üũ(4Ʈ,  12Ʈ 4Ʈ xor)
+ * 		    ESC   üũ 
+ * @param value: 0 , 1 ~ 47 , 48 ~ 2047 Ʋ
+ * @param telemetry: ڷƮ û 
+ * @retval 16Ʈ Ŷ
+ */
+uint16_t dshotPacket(uint16_t value, bool telemetry) {
+	const uint16_t data = (value << 1) | (telemetry & 1);
+	const uint16_t crc = (data ^ (data >> 4) ^ (data >> 8) ^ (dshotBidir ? 0x0f : 0)) & 0x0f;
+	return (data << 4) | crc;
+}
+
+/*
+ * @brief Ŷ DMA  Ʈ  Ǯ
+ * @note ֻ Ʈ, Ʈ  ؼ б   
+ * @param packet: 16Ʈ Ŷ
+ * @param buf: ù Ʈ  ġ
+ * @param stride: Ʈ  ()
+ * @retval 
+ */
+void dshotPack(uint16_t packet, uint32_t* buf, uint8_t stride) {
+	uint8_t i;
+	for(i = 0; i < DSHOT_FRAME_BITS; i++) {
+		buf[i * stride] = DSHOT_BIT_0 + ((packet >> (DSHOT_FRAME_BITS - 1 - i)) & 1) * (DSHOT_BIT_1 - DSHOT_BIT_0);
+	}
+}
+
+/*
+ * @brief eRPM  ؼ
+ * @note    Ʈ  ٲ㼭  1,  0 21Ʈ GCR 
+ * 		  5Ʈ ǥ Ǯ 16Ʈ( 3,  9, üũ 4) ,   ڴ  Ʈ ä
+ * 		   Ѱ  20 ݺ  ѹ̶   Ŭ ̳
+ * @param edge:  ĸó 迭
+ * @param count:  
+ * @retval eRPM,  DSHOT_TELEMETRY_INVALID
+ */
+uint32_t dshotDecode(const uint16_t* edge, uint8_t count) {
+	uint32_t gcr = 0;
+	uint8_t bits = 0;
+	uint8_t i;
+	for(i = 1; i <= count && bits < DSHOT_TELEMETRY_BITS; i++) {
+		const uint8_t len = (i < count) ? (((uint16_t)(edge[i] - edge[i - 1]) + (1 << (DSHOT_TELEMETRY_BIT_SHIFT - 1))) >> DSHOT_TELEMETRY_BIT_SHIFT) : DSHOT_TELEMETRY_BITS - bits;
+		if(len == 0 || bits + len > DSHOT_TELEMETRY_BITS) {
+			return DSHOT_TELEMETRY_INVALID;
+		}
+		gcr = (gcr << len) | (1 << (len - 1));
+		bits += len;
+	}
+	if(bits != DSHOT_TELEMETRY_BITS) {
+		return DSHOT_TELEMETRY_INVALID;
+	}
+
+	const uint8_t n0 = dshotGcrTable[gcr & 0x1f];
+	const uint8_t n1 = dshotGcrTable[(gcr >> 5) & 0x1f];
+	const uint8_t n2 = dshotGcrTable[(gcr >> 10) & 0x1f];
+	const uint8_t n3 = dshotGcrTable[(gcr >> 15) & 0x1f];
+	if((n0 | n1 | n2 | n3) & 0xf0) {
+		return DSHOT_TELEMETRY_INVALID;
+	}
+	if((n0 ^ n1 ^ n2 ^ n3) != 0x0f) {
+		return DSHOT_TELEMETRY_INVALID;
+	}
+
+	// ֱ(us) =  << , 0xfff 
+	const uint16_t value = (n3 << 8) | (n2 << 4) | n1;
+	if(value == 0x0fff) {
+		return 0;
+	}
+	const uint32_t period = (uint32_t)(value & 0x01ff) << (value >> 9);
+	if(period == 0) {
+		return DSHOT_TELEMETRY_INVALID;
+	}
+	return 60000000 / period;
+}
+
+/*
+ * @brief   
+ * @note ۸ ġ   dshotUpdate
+ * @param motor:  ȣ
+ * @param value: 0 ~ 2047
+ * @retval 
+ */
+void dshotWrite(uint8_t motor, uint16_t value) {
+	if(motor >= dshotMotorCount) {
+		return;
+	}
+	const motorHardwareMap_t* map = &motorHardwareMap[motor];
+	uint32_t* buf = dshotTimer[dshotMotorTimer[motor]].buf + (map->channel >> 2);
+	dshotPack(dshotPacket(value & 0x07ff, false), buf, 4);
+}
+
+/*
+ * @brief     
+ * @note Ÿ̸Ӹ DMA Ʈ ٽ ѱ⸸ ϸ  ϵ ,   ѹ ȣ
+ * 		      ̸  Ÿ̸Ӵ ǳʶ
+ * 		        ؼϰ  ǵ
+ * 		      30us ڿ Ƿ ȣ   + 30us +  ̺ 
+ * @param 
+ * @retval 
+ */
+void dshotUpdate(void) {
+	uint8_t i, j;
+	for(j = 0; j < dshotTimerCount; j++) {
+		const motorHardwareMap_t* map = dshotTimer[j].map;
+		TIM_TypeDef* tim = map->tim;
+		if(map->dmaStream->CR & DMA_SxCR_EN) {
+			continue;
+		}
+		if(dshotTimer[j].capturing == true) {
+			PROFILE_ENTER();
+			for(i = 0; i < dshotMotorCount; i++) {
+				if(dshotMotorTimer[i] == j) {
+					dshotChannelOutput(i);
+				}
+			}
+			dshotTimer[j].capturing = false;
+			tim->ARR = DSHOT_BIT_LENGTH - 1;
+			tim->CNT = 0;
+			tim->CR1 |= TIM_CR1_ARPE;
+			tim->DIER |= TIM_DIER_UDE;
+			PROFILE_EXIT(PROF_DSHOT);
+		}
+		DMA_ClearFlag(map->dmaStream, map->dmaFlag);
+		map->dmaStream->NDTR = DSHOT_DMA_LENGTH;
+		map->dmaStream->CR |= DMA_SxCR_EN;
+	}
+}
+
+/*
+ * @brief eRPM б
+ * @param motor:  ȣ
+ * @retval    eRPM
+ */
+uint32_t dshotGetErpm(uint8_t motor) {
+	return (motor < dshotMotorCount) ? dshotErpm[motor] : 0;
+}
+
+/*
+ * @brief   RPM б
+ * @param rpm:  ŭ 迭
+ * @retval 
+ */
+void dshotGetRpm(uint32_t* rpm) {
+	uint8_t i;
+	for(i = 0; i < dshotMotorCount; i++) {
+		rpm[i] = dshotErpm[i] * 2 / DSHOT_MOTOR_POLES;
+	}
+}
+
+/*
+ * @brief   б
+ * @note  = (errorCount + timeoutCount) / ü
+ * @param motor:  ȣ
+ * @param stat: 踦  ü 
+ * @retval 
+ */
+void dshotGetTelemetryStat(uint8_t motor, dshotTelemetryStat_t* stat) {
+	if(motor < dshotMotorCount) {
+		*stat = dshotStat[motor];
+	}
+}
+
+/*
+ * @brief   Ϸ ͷƮ ڵ鷯
+ * @note   ĭ µɶ ϷǹǷ  ̹   
+ * 		  Ʈ DMA û  ī͸ 16Ʈ ü  äε Էĸó ٲ
+ * @param j: Ÿ̸ ȣ
+ * @retval 
+ */
+static void dshotDmaHandler(uint8_t j) {
+	uint8_t i;
+	const motorHardwareMap_t* map = dshotTimer[j].map;
+	TIM_TypeDef* tim = map->tim;
+
+	tim->DIER &= ~TIM_DIER_UDE;
+	tim->CR1 &= ~TIM_CR1_ARPE;
+	tim->ARR = 0xffff;
+	for(i = 0; i < dshotMotorCount; i++) {
+		if(dshotMotorTimer[i] == j) {
+			dshotChannelInput(i);
+		}
+	}
+	dshotTimer[j].capturing = true;
+}
+
+/*
+ * @brief stream ϳ ۿϷ ͷƮ,  stream  Ÿ̸ ó
+ * @param stream: Ʈ DMA stream
+ * @param it: ۿϷ ͷƮ ÷
+ * @retval 
+ */
+static void dshotDmaIrq(DMA_Stream_TypeDef* stream, uint32_t it) {
+	uint8_t j;
+	if(DMA_GetITStatus(stream, it) != RESET) {
+		DMA_ClearITPendingBit(stream, it);
+		for(j = 0; j < dshotTimerCount; j++) {
+			if(dshotTimer[j].map->dmaStream == stream) {
+				dshotDmaHandler(j);
+			}
+		}
+	}
+}
+
+#ifdef BOARD_DSHOT_DMA1_IRQHandler
+void BOARD_DSHOT_DMA1_IRQHandler(void) {
+	dshotDmaIrq(BOARD_DSHOT_DMA1);
+}
+#endif
+
+#ifdef BOARD_DSHOT_DMA2_IRQHandler
+void BOARD_DSHOT_DMA2_IRQHandler(void) {
+	dshotDmaIrq(BOARD_DSHOT_DMA2);
+}
+#endif
@@ -0,0 +1,64 @@
+#ifndef _DSHOT_H_
+#define _DSHOT_H_
+
+#include <motor.h>
+
+#ifndef bool
+typedef uint8_t bool;
+#define false (bool) 0
+#define true (bool) 1
+#define NULL ((void *)0)
+#endif
+
+#define DSHOT_FRAME_BITS     16
+#define DSHOT_BIT_LENGTH     20 //  Ʈ Ÿ̸ ƽ 
+#define DSHOT_BIT_0          7  // 35%
+#define DSHOT_BIT_1          15 // 75%
+#define DSHOT_TIMER_MAX      2
+#define DSHOT_DMA_LENGTH     ((DSHOT_FRAME_BITS + 2) * 4) // Ʈ CCR1 ~ CCR4,   ĭ   δ 0
+#define DSHOT_THROTTLE_MIN   48
+#define DSHOT_THROTTLE_MAX   2047
+
+#define DSHOT_TELEMETRY_BITS       21 // GCR 20Ʈ + ۺƮ
+#define DSHOT_TELEMETRY_EDGES      24 // ĸó  ũ, 21Ʈ  ִ 21
+#define DSHOT_TELEMETRY_BIT_SHIFT  4  //   5/4 ӵ  Ʈ 16(2^4) ƽ
+#define DSHOT_TELEMETRY_INVALID    0xffffffff
+#define DSHOT_NVIC_PRIORITY        1
+
+/*
+ * @brief   , RPM = eRPM / (  / 2)
+ */
+#ifndef DSHOT_MOTOR_POLES
+#define DSHOT_MOTOR_POLES          14
+#endif
+
+/*
+ * @brief DShot ӵ ü
+ */
+typedef enum {
+	DSHOT150 = 0,
+	DSHOT300,
+	DSHOT600,
+} dshotType_t;
+
+/*
+ * @brief  DShot ͺ  
+ */
+typedef struct {
+	uint32_t frameCount;   //  
+	uint32_t errorCount;   // , GCR, CRC 
+	uint32_t timeoutCount; //  
+} dshotTelemetryStat_t;
+
+void dshotInit(dshotType_t type, uint8_t motorCount, bool bidir);
+uint16_t dshotPrescaler(uint32_t timerClock, dshotType_t type);
+uint16_t dshotPacket(uint16_t value, bool telemetry);
+void dshotPack(uint16_t packet, uint32_t* buf, uint8_t stride);
+uint32_t dshotDecode(const uint16_t* edge, uint8_t count);
+void dshotWrite(uint8_t motor, uint16_t value);
+void dshotUpdate(void);
+uint32_t dshotGetErpm(uint8_t motor);
+void dshotGetRpm(uint32_t* rpm);
+void dshotGetTelemetryStat(uint8_t motor, dshotTelemetryStat_t* stat);
+
+#endif
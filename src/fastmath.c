@@ -0,0 +1,108 @@
+#include <stm32f4xx.h>
+#include <math.h>
+#include <fastmath.h>
+
+/*
+ * @note sqrtf -fno-math-errno ϸ VSQRT.F32   ϵ
+ */
+
+/*
+ * @brief  sin
+ * @note [-pi, pi]  ̰ [-pi/2, pi/2]   9 Ȧ ׽ ٻ
+ * @param x: (rad)
+ * @retval sin(x)
+ */
+float sinApprox(float x) {
+	//   2*pi  
+	const int32_t k = (int32_t)(x * (1.0f / M_2PI_F) + ((x >= 0.0f) ? 0.5f : -0.5f));
+	x -= k * M_2PI_F;
+
+	if(x > M_PI_2_F) {
+		x = M_PI_F - x;
+	}
+	else if(x < -M_PI_2_F) {
+		x = -M_PI_F - x;
+	}
+
+	const float x2 = x * x;
+	return x * (1.0f + x2 * (-1.666665710e-1f + x2 * (8.333017292e-3f + x2 * (-1.980661520e-4f + x2 * 2.601903036e-6f))));
+}
+
+/*
+ * @brief  cos
+ * @param x: (rad)
+ * @retval cos(x)
+ */
+float cosApprox(float x) {
+	return sinApprox(x + M_PI_2_F);
+}
+
+/*
+ * @brief  atan2
+ * @note [0, 1] 9 Ȧ ׽ atan ٻϰ Ⱥи ħ
+ * @param y: y
+ * @param x: x
+ * @retval atan2(y, x), rad
+ */
+float atan2Approx(float y, float x) {
+	const float absX = (x > 0.0f) ? x : -x;
+	const float absY = (y > 0.0f) ? y : -y;
+	const float maxXY = (absX > absY) ? absX : absY;
+	const float minXY = (absX > absY) ? absY : absX;
+	if(maxXY == 0.0f) {
+		return 0.0f;
+	}
+	const float z = minXY / maxXY;
+	const float z2 = z * z;
+	float a = z * (0.9998660f + z2 * (-0.3302995f + z2 * (0.1801410f + z2 * (-0.0851330f + z2 * 0.0208351f))));
+	if(absY > absX) {
+		a = M_PI_2_F - a;
+	}
+	if(x < 0.0f) {
+		a = M_PI_F - a;
+	}
+	return (y < 0.0f) ? -a : a;
+}
+
+/*
+ * @brief  asin
+ * @note asin(x) = pi/2 - sqrt(1 - x) * P(x), 0 <= x <= 1 (Abramowitz & Stegun 4.4.46)
+ * @param x: -1 ~ 1
+ * @retval asin(x), rad
+ */
+float asinApprox(float x) {
+	const float absX = (x > 0.0f) ? ((x < 1.0f) ? x : 1.0f) : ((x > -1.0f) ? -x : 1.0f);
+	const float p = 1.5707963050f + absX * (-0.2145988016f + absX * (0.0889789874f + absX * (-0.0501743046f
+			+ absX * (0.0308918810f + absX * (-0.0170881256f + absX * (0.0066700901f + absX * -0.0012624911f))))));
+	const float a = M_PI_2_F - sqrtf(1.0f - absX) * p;
+	return (x < 0.0f) ? -a : a;
+}
+
+/*
+ * @brief  acos
+ * @param x: -1 ~ 1
+ * @retval acos(x), rad
+ */
+float acosApprox(float x) {
+	return M_PI_2_F - asinApprox(x);
+}
+
+/*
+ * @brief  
+ * @note Ϲ 2ȸ ݺ
+ * 		  1ȸ ݺϸ  0.2% Ǿ ȭ ݺҶ ʹϾ 鸲
+ * @param x: Է° (> 0)
+ * @retval 1 / sqrt(x)
+ */
+float invSqrt(float x) {
+	union {
+		float f;
+		int32_t i;
+	} conv;
+	const float halfx = 0.5f * x;
+	conv.f = x;
+	conv.i = 0x5f3759df - (conv.i >> 1);
+	conv.f = conv.f * (1.5f - halfx * conv.f * conv.f);
+	conv.f = conv.f * (1.5f - halfx * conv.f * conv.f);
+	return conv.f;
+}
@@ -0,0 +1,43 @@
+#ifndef _FASTMATH_H_
+#define _FASTMATH_H_
+
+#include <stdint.h>
+
+#define M_PI_F        3.14159265358979323846f
+#define M_2PI_F       6.28318530717958647692f
+#define M_PI_2_F      1.57079632679489661923f
+#define RAD_TO_DEG_F  57.2957795130823208768f
+#define DEG_TO_RAD_F  0.01745329251994329577f
+
+/*
+ * @brief е ٻ Լ
+ * @note ִ Է   float  libm(double)   
+ * 		  sinApprox, cosApprox: 2.9e-7 (|x| <= 2*pi), μ Ŀ   
+ * 		  atan2Approx: 1.2e-5 rad
+ * 		  asinApprox: 3.0e-7 rad, acosApprox: 4.4e-7 rad (|x| <= 1,   ߶)
+ * 		  invSqrt:  4.8e-6 (x > 0, ȭ )
+ */
+float sinApprox(float x);
+float cosApprox(float x);
+float atan2Approx(float y, float x);
+float asinApprox(float x);
+float acosApprox(float x);
+float invSqrt(float x);
+
+/*
+ * @brief 밪, μ ѹ ϹǷ ۿ ִ  ־ 
+ * @note system.h abs ũΰ μ ŸԿ  , absf VABS  ϳ
+ */
+static inline float absf(float x) {
+	return __builtin_fabsf(x);
+}
+
+static inline double absd(double x) {
+	return __builtin_fabs(x);
+}
+
+static inline int32_t absi(int32_t x) {
+	return (x < 0) ? -x : x;
+}
+
+#endif
@@ -0,0 +1,342 @@
+#include <stm32f4xx.h>
+#include <stm32f4xx_conf.h>
+#include <math.h>
+#include <fastmath.h>
+#include <filter.h>
+#include <fft.h>
+#include <system.h>
+#include <ccm.h>
+
+/*
+ * @brief (ġ) ø ļ м ø ļ
+ */
+static float fftSampleHz;
+static float fftBinHz;
+
+/*
+ * @brief ø̼() 
+ */
+static uint8_t fftDecimation = 1;
+static uint8_t fftDecimationCount = 0;
+static float fftDecimationSum[FFT_AXIS_MAX];
+
+/*
+ * @brief ະ м , fftSampleIndex    Ŵ
+ */
+static float fftSample[FFT_AXIS_MAX][FFT_WINDOW_SIZE] CCM_BSS;
+static uint8_t fftSampleIndex = 0;
+
+/*
+ * @brief ʱȭ Ǵ ̺
+ */
+static float fftWindow[FFT_WINDOW_SIZE] CCM_BSS; // hann 
+static float fftCos[FFT_WINDOW_SIZE] CCM_BSS; // cos(2*pi*k/N)
+static float fftSin[FFT_WINDOW_SIZE] CCM_BSS; // sin(2*pi*k/N)
+static uint8_t fftDigitReverse[FFT_BIN_COUNT]; // radix-4  (4 ڸ )
+
+/*
+ * @brief ۾ , Ҽ FFT_BIN_COUNT Ǽ/  
+ */
+static float fftData[FFT_WINDOW_SIZE] CCM_BSS;
+static float fftMag[FFT_BIN_COUNT] CCM_BSS; // ũ 
+
+/*
+ * @brief   ܰ
+ */
+static uint8_t fftAxis = 0;
+static fftStep_t fftStep = FFT_STEP_WINDOW;
+static fftStageTime_t fftStageTime[FFT_STEP_MAX];
+
+/*
+ * @brief  ũ ļ ġ
+ */
+static float fftPeakFreq[FFT_AXIS_MAX][FFT_PEAK_MAX];
+static uint8_t fftNotchEnable[FFT_AXIS_MAX][FFT_PEAK_MAX];
+static biquadFilter_t fftNotch[FFT_AXIS_MAX][FFT_PEAK_MAX] CCM_BSS;
+
+/*
+ * @brief fft ʱȭ
+ * @param sampleHz: fftFilterApply ȣǴ ļ(̷  ļ)
+ * @retval 
+ */
+void fftInit(float sampleHz) {
+	uint8_t i, j;
+
+	fftSampleHz = sampleHz;
+	fftDecimation = (sampleHz > FFT_ANALYSIS_HZ) ? (uint8_t)(sampleHz / FFT_ANALYSIS_HZ) : 1;
+	fftBinHz = (sampleHz / fftDecimation) / FFT_WINDOW_SIZE;
+
+	for(i = 0; i < FFT_WINDOW_SIZE; i++) {
+		fftWindow[i] = 0.5f - 0.5f * cosApprox(2.0f * M_PI_F * i / (FFT_WINDOW_SIZE - 1));
+		fftCos[i] = cosApprox(2.0f * M_PI_F * i / FFT_WINDOW_SIZE);
+		fftSin[i] = sinApprox(2.0f * M_PI_F * i / FFT_WINDOW_SIZE);
+	}
+	for(i = 0; i < FFT_BIN_COUNT; i++) {
+		// 64 = 4^3, 4 3ڸ 
+		fftDigitReverse[i] = ((i & 0x03) << 4) | (i & 0x0c) | ((i >> 4) & 0x03);
+	}
+
+	for(i = 0; i < FFT_AXIS_MAX; i++) {
+		for(j = 0; j < FFT_PEAK_MAX; j++) {
+			fftPeakFreq[i][j] = 0.0f;
+			fftNotchEnable[i][j] = 0;
+			biquadFilterInit(&fftNotch[i][j], BIQUAD_NOTCH, sampleHz, FFT_MAX_HZ, FFT_NOTCH_Q);
+		}
+	}
+}
+
+/*
+ * @brief ġ   м ۿ  
+ * @note м   ȣ , ̷θ  ȣ
+ * @param gyro: 3 ̷  , ͸  
+ * @retval 
+ */
+void fftFilterApply(float* gyro) {
+	uint8_t axis, peak;
+	for(axis = 0; axis < FFT_AXIS_MAX; axis++) {
+		fftDecimationSum[axis] += gyro[axis];
+		for(peak = 0; peak < FFT_PEAK_MAX; peak++) {
+			if(fftNotchEnable[axis][peak]) {
+				gyro[axis] = biquadFilterApply(&fftNotch[axis][peak], gyro[axis]);
+			}
+		}
+	}
+
+	if(++fftDecimationCount >= fftDecimation) {
+		for(axis = 0; axis < FFT_AXIS_MAX; axis++) {
+			fftSample[axis][fftSampleIndex] = fftDecimationSum[axis] / fftDecimationCount;
+			fftDecimationSum[axis] = 0.0f;
+		}
+		fftSampleIndex = (fftSampleIndex + 1) & (FFT_WINDOW_SIZE - 1);
+		fftDecimationCount = 0;
+	}
+}
+
+/*
+ * @brief  , Ǽ Է 2 Ҽ 1 
+ * @param axis: м 
+ * @retval 
+ */
+static void fftWindowing(uint8_t axis) {
+	uint8_t i;
+	for(i = 0; i < FFT_WINDOW_SIZE; i++) {
+		fftData[i] = fftSample[axis][(fftSampleIndex + i) & (FFT_WINDOW_SIZE - 1)] * fftWindow[i];
+	}
+}
+
+/*
+ * @brief radix-4 DIF ö  
+ * @note  4 ڸ   , fftSplit 
+ * @param stage: 0 ~ 2
+ * @retval 
+ */
+static void fftRadix4Stage(uint8_t stage) {
+	const uint8_t n1 = FFT_BIN_COUNT >> (2 * stage); // ̹  κ FFT ũ
+	const uint8_t n2 = n1 >> 2;
+	const uint8_t twiddleStep = FFT_WINDOW_SIZE / n1; // W_n1^m = W_N^(m * N / n1)
+	uint8_t i, j;
+
+	for(j = 0; j < n2; j++) {
+		const uint8_t k1 = j * twiddleStep;
+		const uint8_t k2 = k1 * 2;
+		const uint8_t k3 = k1 * 3;
+		const float c1 = fftCos[k1], s1 = fftSin[k1];
+		const float c2 = fftCos[k2], s2 = fftSin[k2];
+		const float c3 = fftCos[k3], s3 = fftSin[k3];
+
+		for(i = j; i < FFT_BIN_COUNT; i += n1) {
+			float* a = &fftData[2 * i];
+			float* b = &fftData[2 * (i + n2)];
+			float* c = &fftData[2 * (i + 2 * n2)];
+			float* d = &fftData[2 * (i + 3 * n2)];
+
+			const float t0r = a[0] + c[0], t0i = a[1] + c[1];
+			const float t1r = a[0] - c[0], t1i = a[1] - c[1];
+			const float t2r = b[0] + d[0], t2i = b[1] + d[1];
+			const float t3r = b[0] - d[0], t3i = b[1] - d[1];
+
+			const float y1r = t1r + t3i, y1i = t1i - t3r; // t1 - j*t3
+			const float y2r = t0r - t2r, y2i = t0i - t2i;
+			const float y3r = t1r - t3i, y3i = t1i + t3r; // t1 + j*t3
+
+			a[0] = t0r + t2r;
+			a[1] = t0i + t2i;
+			// y * (cos - j*sin)
+			b[0] = y1r * c1 + y1i * s1;
+			b[1] = y1i * c1 - y1r * s1;
+			c[0] = y2r * c2 + y2i * s2;
+			c[1] = y2i * c2 - y2r * s2;
+			d[0] = y3r * c3 + y3i * s3;
+			d[1] = y3i * c3 - y3r * s3;
+		}
+	}
+}
+
+/*
+ * @brief  ũ Ҽ FFT  Ǽ FFT  и, ũ  
+ * @param 
+ * @retval 
+ */
+static void fftSplit(void) {
+	uint8_t k;
+	fftMag[0] = 0.0f; // DC  
+	for(k = 1; k < FFT_BIN_COUNT; k++) {
+		const float* zk = &fftData[2 * fftDigitReverse[k]];
+		const float* zm = &fftData[2 * fftDigitReverse[FFT_BIN_COUNT - k]];
+
+		// ¦   Fe = (Z[k] + conj(Z[M-k])) / 2
+		const float evenR = 0.5f * (zk[0] + zm[0]);
+		const float evenI = 0.5f * (zk[1] - zm[1]);
+		// Ȧ   Fo = (Z[k] - conj(Z[M-k])) / 2j
+		const float oddR = 0.5f * (zk[1] + zm[1]);
+		const float oddI = -0.5f * (zk[0] - zm[0]);
+
+		const float xr = evenR + fftCos[k] * oddR + fftSin[k] * oddI;
+		const float xi = evenI + fftCos[k] * oddI - fftSin[k] * oddR;
+		fftMag[k] = xr * xr + xi * xi;
+	}
+}
+
+/*
+ * @brief ũ Ž  ġ 
+ * @param axis: м 
+ * @retval 
+ */
+static void fftPeakUpdate(uint8_t axis) {
+	uint8_t minBin = (uint8_t)(FFT_MIN_HZ / fftBinHz) + 1;
+	uint8_t maxBin = (uint8_t)(FFT_MAX_HZ / fftBinHz);
+	uint8_t peakBin[FFT_PEAK_MAX] = { 0, };
+	uint8_t peakCount = 0;
+	float mean = 0.0f;
+	uint8_t i, j, k;
+
+	if(maxBin > FFT_BIN_COUNT - 2) {
+		maxBin = FFT_BIN_COUNT - 2;
+	}
+	if(minBin < 2) {
+		minBin = 2;
+	}
+	if(minBin > maxBin) {
+		return;
+	}
+
+	for(k = minBin; k <= maxBin; k++) {
+		mean += fftMag[k];
+	}
+	mean /= (maxBin - minBin + 1);
+
+	// hann 쿡  A  ũ A * N / 4
+	float threshold = FFT_PEAK_MIN_AMP * FFT_WINDOW_SIZE / 4;
+	threshold *= threshold;
+	if(mean * FFT_PEAK_RATIO > threshold) {
+		threshold = mean * FFT_PEAK_RATIO;
+	}
+
+	// ũ  FFT_PEAK_MAX ش밪 ã
+	for(k = minBin; k <= maxBin; k++) {
+		if(fftMag[k] > fftMag[k - 1] && fftMag[k] >= fftMag[k + 1] && fftMag[k] > threshold) {
+			for(i = 0; i < FFT_PEAK_MAX; i++) {
+				if(i >= peakCount || fftMag[k] > fftMag[peakBin[i]]) {
+					for(j = FFT_PEAK_MAX - 1; j > i; j--) {
+						peakBin[j] = peakBin[j - 1];
+					}
+					peakBin[i] = k;
+					if(peakCount < FFT_PEAK_MAX) {
+						peakCount++;
+					}
+					break;
+				}
+			}
+		}
+	}
+
+	// ġ  鸮 ʵ ļ  
+	for(i = 1; i < peakCount; i++) {
+		for(j = i; j > 0 && peakBin[j] < peakBin[j - 1]; j--) {
+			k = peakBin[j];
+			peakBin[j] = peakBin[j - 1];
+			peakBin[j - 1] = k;
+		}
+	}
+
+	for(i = 0; i < peakCount; i++) {
+		k = peakBin[i];
+		//   3 ũ  
+		const float y0 = sqrtf(fftMag[k - 1]);
+		const float y1 = sqrtf(fftMag[k]);
+		const float y2 = sqrtf(fftMag[k + 1]);
+		const float denom = y0 - 2.0f * y1 + y2;
+		const float delta = (denom != 0.0f) ? 0.5f * (y0 - y2) / denom : 0.0f;
+		float freq = (k + delta) * fftBinHz;
+
+		if(fftNotchEnable[axis][i]) {
+			freq = fftPeakFreq[axis][i] + FFT_PEAK_SMOOTH * (freq - fftPeakFreq[axis][i]);
+		}
+		freq = (freq < FFT_MIN_HZ) ? FFT_MIN_HZ : ((freq > FFT_MAX_HZ) ? FFT_MAX_HZ : freq);
+
+		fftPeakFreq[axis][i] = freq;
+		fftNotchEnable[axis][i] = 1;
+		biquadFilterUpdate(&fftNotch[axis][i], BIQUAD_NOTCH, fftSampleHz, freq, FFT_NOTCH_Q);
+	}
+}
+
+/*
+ * @brief fft м 
+ * @note ѹ ȣ⿡    ܰ踸 óϿ  ð  ʵ 
+ * 		    м FFT_STEP_MAX,    FFT_STEP_MAX * 3 ȣ ʿ
+ * @param 
+ * @retval 
+ */
+void fftUpdate(void) {
+	const uint32_t start = cycles();
+	const fftStep_t step = fftStep;
+
+	switch(step) {
+	case FFT_STEP_WINDOW:
+		fftWindowing(fftAxis);
+		break;
+	case FFT_STEP_STAGE_1:
+	case FFT_STEP_STAGE_2:
+	case FFT_STEP_STAGE_3:
+		fftRadix4Stage(step - FFT_STEP_STAGE_1);
+		break;
+	case FFT_STEP_SPLIT:
+		fftSplit();
+		break;
+	case FFT_STEP_PEAK:
+		fftPeakUpdate(fftAxis);
+		break;
+	default:
+		break;
+	}
+
+	if(++fftStep >= FFT_STEP_MAX) {
+		fftStep = FFT_STEP_WINDOW;
+		fftAxis = (fftAxis + 1) % FFT_AXIS_MAX;
+	}
+
+	const uint32_t time = cycles() - start;
+	fftStageTime[step].last = time;
+	if(time > fftStageTime[step].max) {
+		fftStageTime[step].max = time;
+	}
+}
+
+/*
+ * @brief  ũ ļ б
+ * @param axis: 
+ * @param peak: ũ ȣ, ļ  
+ * @retval ũ ļ(float),  ã  0
+ */
+float fftGetPeakFreq(uint8_t axis, uint8_t peak) {
+	return fftPeakFreq[axis][peak];
+}
+
+/*
+ * @brief ܰ躰 ð б
+ * @param step: fft ܰ ü
+ * @retval ð ü , Ŭ 
+ */
+const fftStageTime_t* fftGetStageTime(fftStep_t step) {
+	return &fftStageTime[step];
+}
@@ -0,0 +1,44 @@
+#ifndef _FFT_H_
+#define _FFT_H_
+
+#define FFT_AXIS_MAX      3
+#define FFT_WINDOW_SIZE   128                   // Ǽ Է  
+#define FFT_BIN_COUNT     (FFT_WINDOW_SIZE / 2) // Ҽ FFT ũ, 4^3 ̹Ƿ radix-4 3
+#define FFT_ANALYSIS_HZ   1000                  // м ø ļ ǥ,  ļ ø̼
+#define FFT_PEAK_MAX      2                     // ึ  ũ (ġ )
+#define FFT_MIN_HZ        80
+#define FFT_MAX_HZ        450
+#define FFT_NOTCH_Q       3.5f
+#define FFT_PEAK_SMOOTH   0.3f                  // ũ ļ    
+#define FFT_PEAK_RATIO    4.0f                  //     ̻϶ ũ 
+#define FFT_PEAK_MIN_AMP  1.0f                  // ũ  ּ , Է (deg/s)
+
+/*
+ * @brief fft ܰ ü
+ * @note ѹ fftUpdate ȣ⿡    ܰ踸 ó
+ */
+typedef enum {
+	FFT_STEP_WINDOW = 0,
+	FFT_STEP_STAGE_1,
+	FFT_STEP_STAGE_2,
+	FFT_STEP_STAGE_3,
+	FFT_STEP_SPLIT,
+	FFT_STEP_PEAK,
+	FFT_STEP_MAX,
+} fftStep_t;
+
+/*
+ * @brief fft ܰ躰 ð ü, Ŭ 
+ */
+typedef struct {
+	uint32_t last;
+	uint32_t max;
+} fftStageTime_t;
+
+void fftInit(float sampleHz);
+void fftFilterApply(float* gyro);
+void fftUpdate(void);
+float fftGetPeakFreq(uint8_t axis, uint8_t peak);
+const fftStageTime_t* fftGetStageTime(fftStep_t step);
+
+#endif
@@ -0,0 +1,69 @@
+#include <stm32f4xx.h>
+#include <fastmath.h>
+#include <filter.h>
+
+/*
+ * @brief   ʱȭ
+ * @param filter: ʱȭ  ü 
+ * @param type:  Ÿ ü(BIQUAD_LPF, BIQUAD_NOTCH)
+ * @param sampleHz: Ͱ ȣǴ ø ļ
+ * @param centerHz: (߽) ļ
+ * @param q: Q, ġʹ ߽ļ/뿪
+ * @retval 
+ */
+void biquadFilterInit(biquadFilter_t* filter, biquadType_t type, float sampleHz, float centerHz, float q) {
+	filter->s1 = 0.0f;
+	filter->s2 = 0.0f;
+	biquadFilterUpdate(filter, type, sampleHz, centerHz, q);
+}
+
+/*
+ * @brief    
+ * @note   ϹǷ ߿ ߽ļ Űܵ  Ƣ 
+ * @param filter:   ü 
+ * @param type:  Ÿ ü
+ * @param sampleHz: ø ļ
+ * @param centerHz: (߽) ļ
+ * @param q: Q
+ * @retval 
+ */
+void biquadFilterUpdate(biquadFilter_t* filter, biquadType_t type, float sampleHz, float centerHz, float q) {
+	const float omega = 2.0f * M_PI_F * centerHz / sampleHz;
+	const float sn = sinApprox(omega);
+	const float cs = cosApprox(omega);
+	const float alpha = sn / (2.0f * q);
+	float b0 = 0.0f, b1 = 0.0f, b2 = 0.0f;
+
+	switch(type) {
+	case BIQUAD_LPF:
+		b0 = (1.0f - cs) * 0.5f;
+		b1 = 1.0f - cs;
+		b2 = b0;
+		break;
+	case BIQUAD_NOTCH:
+		b0 = 1.0f;
+		b1 = -2.0f * cs;
+		b2 = 1.0f;
+		break;
+	}
+
+	const float a0 = 1.0f + alpha;
+	filter->b0 = b0 / a0;
+	filter->b1 = b1 / a0;
+	filter->b2 = b2 / a0;
+	filter->a1 = (-2.0f * cs) / a0;
+	filter->a2 = (1.0f - alpha) / a0;
+}
+
+/*
+ * @brief   
+ * @param filter:  ü 
+ * @param input: Է 
+ * @retval ͸ (float)
+ */
+float biquadFilterApply(biquadFilter_t* filter, float input) {
+	const float output = filter->b0 * input + filter->s1;
+	filter->s1 = filter->b1 * input - filter->a1 * output + filter->s2;
+	filter->s2 = filter->b2 * input - filter->a2 * output;
+	return output;
+}
@@ -0,0 +1,26 @@
+#ifndef _FILTER_H_
+#define _FILTER_H_
+
+/*
+ * @brief   Ÿ ü
+ */
+typedef enum {
+	BIQUAD_LPF = 0,
+	BIQUAD_NOTCH,
+} biquadType_t;
+
+/*
+ * @brief   ü
+ * @note Direct Form II Transposed,  a0 ȭǾ 
+ */
+typedef struct {
+	float b0, b1, b2;
+	float a1, a2;
+	float s1, s2; //  
+} biquadFilter_t;
+
+void biquadFilterInit(biquadFilter_t* filter, biquadType_t type, float sampleHz, float centerHz, float q);
+void biquadFilterUpdate(biquadFilter_t* filter, biquadType_t type, float sampleHz, float centerHz, float q);
+float biquadFilterApply(biquadFilter_t* filter, float input);
+
+#endif
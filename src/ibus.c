@@ -0,0 +1,65 @@
+#include <stm32f4xx.h>
+#include <stm32f4xx_conf.h>
+#include <ibus.h>
+
+/*
+ * @brief   Ǵ
+ * @note : 0x20, 0x40, ä(2 * 14, Ʋ), üũ(2)
+ * @param buf:  Ʈ
+ * @param len:  Ʈ 
+ * @retval  ,  Ʋ 0
+ */
+static uint8_t ibusFrameSize(const uint8_t* buf, uint8_t len) {
+	if(buf[0] != IBUS_HEADER_1) {
+		return 0;
+	}
+	if(len < 2) {
+		return 2;
+	}
+	return (buf[1] == IBUS_HEADER_2) ? IBUS_FRAME_SIZE : 0;
+}
+
+/*
+ * @brief üũ ˻, 0xffff üũ ձ Ʈ   
+ * @param frame: 
+ * @param size:  
+ * @retval ġϸ true
+ */
+static bool ibusFrameCheck(const uint8_t* frame, uint8_t size) {
+	uint16_t sum = 0xffff;
+	uint8_t i;
+	for(i = 0; i < size - 2; i++) {
+		sum -= frame[i];
+	}
+	return sum == (frame[size - 2] | (frame[size - 1] << 8));
+}
+
+/*
+ * @brief ä  Ǯ, ä  ״ us
+ * @param frame: 
+ * @param size:  
+ * @param channel: ä  ȯ  
+ * @retval ä 
+ */
+static uint8_t ibusFrameDecode(const uint8_t* frame, uint8_t size, uint16_t* channel) {
+	uint8_t i;
+	(void)size; // ׻ IBUS_FRAME_SIZE(ibusFrameSize)
+	for(i = 0; i < IBUS_CHANNEL_MAX; i++) {
+		channel[i] = (frame[2 + i * 2] | (frame[3 + i * 2] << 8)) & 0x0fff;
+	}
+	return IBUS_CHANNEL_MAX;
+}
+
+/*
+ * @brief iBUS , 115200bps 8N1
+ */
+const serialRxProtocol_t ibusProtocol = {
+	.baudRate = IBUS_BAUDRATE,
+	.parity = USART_Parity_No,
+	.stopBits = USART_StopBits_1,
+	.inverted = false,
+	.frameSizeMax = IBUS_FRAME_SIZE,
+	.frameSize = ibusFrameSize,
+	.frameCheck = ibusFrameCheck,
+	.frameDecode = ibusFrameDecode,
+};
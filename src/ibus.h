@@ -0,0 +1,14 @@
+#ifndef _IBUS_H_
+#define _IBUS_H_
+
+#include <serialrx.h>
+
+#define IBUS_BAUDRATE      115200
+#define IBUS_FRAME_SIZE    32
+#define IBUS_CHANNEL_MAX   14
+#define IBUS_HEADER_1      0x20 //  
+#define IBUS_HEADER_2      0x40 // ä 
+
+extern const serialRxProtocol_t ibusProtocol;
+
+#endif
@@ -0,0 +1,11 @@
+#include <stm32f4xx.h>
+#include <stm32f4xx_conf.h>
+#include <motor.h>
+
+/*
+ * @brief   ϵ ,  ǿ ѹ 
+ * @note dshot.c pwmout.c  
+ */
+const motorHardwareMap_t motorHardwareMap[MOTOR_MAX] = {
+	{ BOARD_MOTOR1 }, { BOARD_MOTOR2 }, { BOARD_MOTOR3 }, { BOARD_MOTOR4 },
+};
@@ -0,0 +1,38 @@
+#ifndef _MOTOR_H_
+#define _MOTOR_H_
+
+#include <stm32f4xx.h>
+#include <stm32f4xx_conf.h>
+#include <board.h>
+
+#define MOTOR_MAX 4
+
+/*
+ * @brief   ϵ Ÿ ü
+ * @note DMA Ÿ̸ Ʈ û,  Ÿ̸ äγ  ̾
+ */
+typedef struct {
+	TIM_TypeDef *tim;
+	GPIO_TypeDef *gpio;
+	uint16_t pin;
+	uint8_t pinSource;
+	uint16_t channel; // TIM_Channel_x
+	uint32_t gpioClock;
+	uint32_t timClock;
+	uint8_t gpioAF;
+	DMA_Stream_TypeDef *dmaStream;
+	uint32_t dmaChannel;
+	uint32_t dmaFlag; // Ʈ  ÷, ٽ Ҷ clear
+	uint32_t dmaClock;
+	uint8_t dmaIrq;
+	DMA_Stream_TypeDef *captureDmaStream; // ä ĸó û,  DShot  
+	uint32_t captureDmaChannel;
+	uint32_t captureDmaFlag;
+} motorHardwareMap_t;
+
+/*
+ * @brief   ϵ ,  board.h
+ */
+extern const motorHardwareMap_t motorHardwareMap[MOTOR_MAX];
+
+#endif
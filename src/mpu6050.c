@@ -3,32 +3,142 @@
 #include <drv_i2c.h>
 #include <mpu6050.h>
 #include <system.h>
+#include <seqlock.h>
+#include <config.h>
+#include <startup.h>
+#include <string.h>
 
 /*
  * @brief  i2c ġ  
  */
 static i2cDevice_t i2cDevice = 0;
 
+/*
+ * @brief   
+ * @note mpu6050Work mpu6050Update ġ    
+ */
+static imuSnapshot_t mpu6050Work;
+static imuSnapshot_t mpu6050Snapshot[2];
+static seqlock_t mpu6050Lock;
+
+/*
+ * @brief ̷ ,  ҿ ҷ
+ */
+static int16_t mpu6050GyroBias[3] = {0, };
+
+/*
+ * @brief  ģ  Ǵ ð(micros),    
+ */
+static uint32_t mpu6050ReadyTime = 0;
+
+/*
+ * @brief ʱȭ ܰ 
+ */
+#define MPU6050_PHASE_RESET (I2C_UNSTICK_PHASES + 1) // 0 ~ I2C_UNSTICK_PHASES i2c ʱȭ
+static i2cInitTypeDef_t mpu6050I2cInit;
+static uint32_t mpu6050ResetTime = 0;
+
 /*
  * @brief mpu6050 ʱȭ
- * @note  lpf  κ  
+ * @note mpu6050InitStep  , ٸ  ٸ  Ϸ mpu6050InitStep startup ܰ 
  * @param i2cDevice_: i2c ġ ü
- * @retval 
+ * @retval error,   ʰų    ERROR
  */
-void mpu6050Init(i2cDevice_t i2cDevice_) {
-	i2cDevice = i2cDevice_;
-	i2cInitTypeDef_t i2cInitStructure;
-	i2cStructInit(&i2cInitStructure);
-	i2cInit(i2cDevice, &i2cInitStructure);
-	i2cWrite(i2cDevice, MPU6050_ADDRESS, MPU_RA_PWR_MGMT_1, 0x80);      //PWR_MGMT_1    -- DEVICE_RESET 1
-	delay(5);
-	i2cWrite(i2cDevice, MPU6050_ADDRESS, MPU_RA_SMPLRT_DIV, 0x00);      //SMPLRT_DIV    -- SMPLRT_DIV = 0  Sample Rate = Gyroscope Output Rate / (1 + SMPLRT_DIV)
-	i2cWrite(i2cDevice, MPU6050_ADDRESS, MPU_RA_PWR_MGMT_1, 0x03);      //PWR_MGMT_1    -- SLEEP 0; CYCLE 0; TEMP_DIS 0; CLKSEL 3 (PLL with Z Gyro reference)
-	/*i2cWrite(i2cDevice, MPU6050_ADDRESS, MPU_RA_INT_PIN_CFG, 0 << 7 | 0 << 6 | 0 << 5 | 0 << 4 | 0 << 3 | 0 << 2 | 1 << 1 | 0 << 0);*/
-	/*i2cWrite(i2cDevice, MPU6050_ADDRESS, MPU_RA_CONFIG, mpuLowPassFilter);*/
-	i2cWrite(i2cDevice, MPU6050_ADDRESS, MPU_RA_GYRO_CONFIG, INV_FSR_2000DPS << 3);
-	i2cWrite(i2cDevice, MPU6050_ADDRESS, MPU_RA_ACCEL_CONFIG, INV_FSR_8G << 3);
-	delay(5);
+ErrorStatus mpu6050Init(i2cDevice_t i2cDevice_) {
+	uint8_t phase = 0;
+	int32_t wait;
+	while((wait = mpu6050InitStep(&i2cDevice_, &phase)) > 0) {
+		delayMicroseconds(wait);
+	}
+	return wait == STARTUP_DONE ? SUCCESS : ERROR;
+}
+
+/*
+ * @brief mpu6050 ʱȭ  ܰ 
+ * @note  lpf  κ  
+ * 		  i2c  Ǯ  Ʈ Ȯ ̿ ٸ ʰ ٸ ð , startupAddStep ٷ   
+ * 		    ð mpu6050Update ǳʶ,  ̷   ҷ(configInit ڿ Ұ)
+ * @param context: i2c ġ ü 
+ * @param phase:  ܰ, ó 0
+ * @retval ٽ θ ٸ ð(us),  STARTUP_DONE
+ * 		    ⳪  Ⱑ ϰų MPU6050_RESET_TIMEOUT_US ȿ  Ʈ Ǯ (б NACK ) STARTUP_FAIL
+ */
+int32_t mpu6050InitStep(void* context, uint8_t* phase) {
+	if(*phase == 0) {
+		i2cDevice = *(const i2cDevice_t*)context;
+		i2cStructInit(&mpu6050I2cInit);
+	}
+	if(*phase <= I2C_UNSTICK_PHASES) {
+		const int32_t wait = i2cInitStep(i2cDevice, &mpu6050I2cInit, phase);
+		if(wait != 0) {
+			return wait;
+		}
+		if(i2cWrite(i2cDevice, MPU6050_ADDRESS, MPU_RA_PWR_MGMT_1, 0x80) == ERROR) { //PWR_MGMT_1    -- DEVICE_RESET 1
+			return STARTUP_FAIL;
+		}
+		mpu6050ResetTime = micros();
+		*phase = MPU6050_PHASE_RESET;
+		return MPU6050_RESET_POLL_US;
+	}
+
+	// ߿ NACK  , ѽð ٽ Ȯ
+	uint8_t pwr = 0x80;
+	if(i2cRead(i2cDevice, MPU6050_ADDRESS, MPU_RA_PWR_MGMT_1, 1, &pwr) == ERROR || (pwr & 0x80)) {
+		if((micros() - mpu6050ResetTime) < MPU6050_RESET_TIMEOUT_US) {
+			return MPU6050_RESET_POLL_US;
+		}
+		return STARTUP_FAIL;
+	}
+
+	if(i2cWrite(i2cDevice, MPU6050_ADDRESS, MPU_RA_SMPLRT_DIV, 0x00) == ERROR            //SMPLRT_DIV    -- SMPLRT_DIV = 0  Sample Rate = Gyroscope Output Rate / (1 + SMPLRT_DIV)
+	|| i2cWrite(i2cDevice, MPU6050_ADDRESS, MPU_RA_PWR_MGMT_1, 0x03) == ERROR            //PWR_MGMT_1    -- SLEEP 0; CYCLE 0; TEMP_DIS 0; CLKSEL 3 (PLL with Z Gyro reference)
+	/*|| i2cWrite(i2cDevice, MPU6050_ADDRESS, MPU_RA_INT_PIN_CFG, 0 << 7 | 0 << 6 | 0 << 5 | 0 << 4 | 0 << 3 | 0 << 2 | 1 << 1 | 0 << 0) == ERROR*/
+	/*|| i2cWrite(i2cDevice, MPU6050_ADDRESS, MPU_RA_CONFIG, mpuLowPassFilter) == ERROR*/
+	|| i2cWrite(i2cDevice, MPU6050_ADDRESS, MPU_RA_GYRO_CONFIG, INV_FSR_2000DPS << 3) == ERROR
+	|| i2cWrite(i2cDevice, MPU6050_ADDRESS, MPU_RA_ACCEL_CONFIG, INV_FSR_8G << 3) == ERROR) {
+		return STARTUP_FAIL;
+	}
+	mpu6050ReadyTime = micros() + MPU6050_SETTLE_US;
+
+	uint16_t len;
+	const void* bias = configGet(CONFIG_KEY_GYRO_BIAS, &len);
+	if(bias != NULL && len == sizeof(mpu6050GyroBias)) {
+		memcpy(mpu6050GyroBias, bias, sizeof(mpu6050GyroBias));
+	}
+	return STARTUP_DONE;
+}
+
+/*
+ * @brief ̷     ҿ 
+ * @note ü   ¿ ȣ, samples д  
+ * 		  ѹ ϸ  úʹ mpu6050Init ҷǷ ٽ  ʾƵ 
+ * @param samples: ճ  
+ * @retval error
+ */
+ErrorStatus mpu6050Calibrate(uint16_t samples) {
+	int32_t sum[3] = {0, 0, 0};
+	int16_t gyro[3];
+	uint16_t count = 0;
+	uint32_t tries = 0;
+	uint8_t i;
+
+	while((int32_t)(micros() - mpu6050ReadyTime) < 0);
+	while(count < samples && tries++ < (uint32_t)samples * 2) { // б а  
+		if(mpu6050Read(GYRO, gyro) == !ERROR) {
+			for(i = 0; i < 3; i++) {
+				sum[i] += gyro[i];
+			}
+			count++;
+		}
+		delayMicroseconds(1000);
+	}
+	if(count < samples) {
+		return ERROR;
+	}
+	for(i = 0; i < 3; i++) {
+		mpu6050GyroBias[i] = sum[i] / count;
+	}
+	return configSet(CONFIG_KEY_GYRO_BIAS, mpu6050GyroBias, sizeof(mpu6050GyroBias));
 }
 
 /*
@@ -115,3 +225,39 @@ ErrorStatus mpu6050Read(mpu6050Type_t type, int16_t* data) {
 	}
 	return !ERROR;
 }
+
+/*
+ * @brief ӵ, ̷θ о  
+ * @note   о ϹǷ  ӵ ̷δ ׻   
+ * @param 
+ * @retval error
+ */
+ErrorStatus mpu6050Update(void) {
+	if((int32_t)(micros() - mpu6050ReadyTime) < 0) {
+		return ERROR; //   Ǵ 
+	}
+	if(mpu6050Read(ACC, mpu6050Work.acc) == ERROR) {
+		return ERROR;
+	}
+	if(mpu6050Read(GYRO, mpu6050Work.gyro) == ERROR) {
+		return ERROR;
+	}
+	uint8_t i;
+	for(i = 0; i < 3; i++) {
+		mpu6050Work.gyro[i] -= mpu6050GyroBias[i];
+	}
+	mpu6050Work.timeUs = micros();
+	mpu6050Work.frameCount++;
+	seqlockWrite(&mpu6050Lock, mpu6050Snapshot, &mpu6050Work, sizeof(imuSnapshot_t));
+	return !ERROR;
+}
+
+/*
+ * @brief   б
+ * @note ͷƮ  ʰ    ü , ͷƮ ȣص 
+ * @param snapshot:   ü 
+ * @retval 
+ */
+void mpu6050GetSnapshot(imuSnapshot_t* snapshot) {
+	seqlockRead(&mpu6050Lock, mpu6050Snapshot, snapshot, sizeof(imuSnapshot_t));
+}
@@ -99,6 +99,10 @@
 
 #define MPU6050_SMPLRT_DIV      0       // 8000Hz
 
+#define MPU6050_RESET_TIMEOUT_US 5000   //  Ʈ Ǯ⸦ ٸ ִ ð
+#define MPU6050_RESET_POLL_US    500    //  Ʈ Ȯ 
+#define MPU6050_SETTLE_US        5000   //   ù б ٸ ð
+
 enum {
     INV_FILTER_256HZ_NOLPF2 = 0,
     INV_FILTER_188HZ,
@@ -140,9 +144,23 @@ typedef enum {
 	GYRO,
 }mpu6050Type_t;
 
+/*
+ * @brief   ü
+ */
+typedef struct {
+	int16_t acc[3];
+	int16_t gyro[3];
+	uint32_t timeUs;     //  ð(micros)
+	uint32_t frameCount; // Ҷ , 0̸    
+} imuSnapshot_t;
+
 #define ACCScaleFactor 0.000244140625
 #define GYROScaleFactor 0.06103515625
 
-void mpu6050Init(i2cDevice_t i2cDevice_);
+ErrorStatus mpu6050Init(i2cDevice_t i2cDevice_);
+int32_t mpu6050InitStep(void* context, uint8_t* phase);
 ErrorStatus mpu6050Read(mpu6050Type_t type, int16_t* data);
+ErrorStatus mpu6050Update(void);
+ErrorStatus mpu6050Calibrate(uint16_t samples);
+void mpu6050GetSnapshot(imuSnapshot_t* snapshot);
 #endif
@@ -0,0 +1,122 @@
+#include <stm32f4xx.h>
+#include <stm32f4xx_conf.h>
+#include <drv_timer.h>
+#include <pwm.h>
+#include <ppm.h>
+#include <rc.h>
+#include <profiler.h>
+#include <seqlock.h>
+#include <system.h>
+
+/*
+ * @brief  
+ */
+static uint16_t ppmPulse[PPM_CHANNEL_MAX];
+static uint8_t ppmPulseIndex = 0;
+static uint32_t ppmPulseSum = 0;
+static bool ppmPulseError = true; // ó ⸦ ã  
+static uint16_t ppmLastCapture = 0;
+static uint8_t ppmLastCount = 0;
+
+/*
+ * @brief ϼ 
+ * @note ppmWork ͷƮ ġ  ϼɶ   
+ */
+static rcSnapshot_t ppmWork;
+static rcSnapshot_t ppmSnapshot[2];
+static seqlock_t ppmLock;
+
+static void ppmCaptureHandler(uint8_t channel, uint16_t capture, bool rising);
+
+/*
+ * @brief ppm ʱȭ
+ * @note Էĸó ä ϳ  ä , ¿   ä 
+ * 		  ¿ Ƿ / ؼ ppm    
+ * @param timerDevice: Ÿ̸ ä ġ ü
+ * @retval 
+ */
+void ppmInit(timerDevice_t timerDevice) {
+	timerInitTypeDef_t timerInitStructure;
+	timerInitStructure.preemptionPriority = 1;
+	timerInitStructure.subPriority = 1;
+	timerInitStructure.tickHz = 1000000; //1us
+	timerInitStructure.mode = TIMER_CAPTURE_RISING;
+
+	timerCaptureInit(timerDevice, &timerInitStructure, ppmCaptureHandler, 0);
+}
+
+/*
+ * @brief ű б
+ * @note  ֱٿ ϼ  RC_MIN ~ RC_MAX ؼ ȯ,    
+ * @param data: 5  ȯ  
+ * @retval 
+ */
+void ppmRead(uint16_t *data) {
+	rcSnapshot_t snapshot;
+	ppmGetSnapshot(&snapshot);
+	uint8_t i = 0;
+	for(; i < RC_CHANNEL_MAX && i < snapshot.channelCount; i++) {
+		uint16_t buf = snapshot.channel[i];
+		if(buf < RC_MIN) {
+			buf = RC_MIN;
+		}
+		else if(buf > RC_MAX) {
+			buf = RC_MAX;
+		}
+		data[i] = buf;
+	}
+}
+
+/*
+ * @brief ű  б
+ * @note ͷƮ  ʰ   ü , frameCount ٲ  ȣ  
+ * @param snapshot:   ü 
+ * @retval 
+ */
+void ppmGetSnapshot(rcSnapshot_t* snapshot) {
+	seqlockRead(&ppmLock, ppmSnapshot, snapshot, sizeof(rcSnapshot_t));
+}
+
+/*
+ * @brief Էĸó ڵ鷯
+ * @note    ݱ  ޽ ˻ؼ  
+ * 		  ä   Ӱ ,  ޽  ̰,  ̰ PPM_FRAME_MAX ϶ 
+ * @param channel: 
+ * @param capture: ĸó ī (us)
+ * @param rising: 
+ * @retval 
+ */
+static void ppmCaptureHandler(uint8_t channel, uint16_t capture, bool rising) {
+	(void)channel;
+	(void)rising;
+	PROFILE_ENTER();
+	const uint16_t width = capture - ppmLastCapture;
+	ppmLastCapture = capture;
+
+	if(width >= PPM_SYNC_MIN) { //  
+		const uint8_t count = ppmPulseIndex;
+		if(ppmPulseError == false && count >= PPM_CHANNEL_MIN && count == ppmLastCount
+				&& ppmPulseSum + width <= PPM_FRAME_MAX) {
+			uint8_t i;
+			for(i = 0; i < count; i++) {
+				ppmWork.channel[i] = ppmPulse[i];
+			}
+			ppmWork.channelCount = count;
+			ppmWork.timeUs = micros();
+			ppmWork.frameCount++;
+			seqlockWrite(&ppmLock, ppmSnapshot, &ppmWork, sizeof(rcSnapshot_t));
+		}
+		ppmLastCount = count;
+		ppmPulseIndex = 0;
+		ppmPulseSum = 0;
+		ppmPulseError = false;
+	}
+	else if(ppmPulseIndex < PPM_CHANNEL_MAX && width >= PPM_PULSE_MIN && width <= PPM_PULSE_MAX) {
+		ppmPulse[ppmPulseIndex++] = width;
+		ppmPulseSum += width;
+	}
+	else { //   ޽,   
+		ppmPulseError = true;
+	}
+	PROFILE_EXIT(PROF_PPM);
+}
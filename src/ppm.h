@@ -0,0 +1,18 @@
+#ifndef _PPM_H_
+#define _PPM_H_
+
+#include <drv_timer.h>
+#include <rc.h>
+
+#define PPM_CHANNEL_MAX   12    // ִ ä 
+#define PPM_CHANNEL_MIN   4     // ̺  ä  
+#define PPM_PULSE_MIN     750   // ä ޽  (us)
+#define PPM_PULSE_MAX     2250
+#define PPM_SYNC_MIN      2700  // ̺     Ǵ(us)
+#define PPM_FRAME_MAX     30000 //     ִ (us)
+
+void ppmInit(timerDevice_t timerDevice);
+void ppmRead(uint16_t *data);
+void ppmGetSnapshot(rcSnapshot_t* snapshot);
+
+#endif
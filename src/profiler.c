@@ -0,0 +1,212 @@
+#include <stm32f4xx.h>
+#include <stm32f4xx_conf.h>
+#include <profiler.h>
+#include <system.h>
+#include <ccm.h>
+
+#define PROFILER_SYNC_1    0xa5
+#define PROFILER_SYNC_2    0x5a
+#define PROFILER_VERSION   1
+#define PROFILER_ENTRY_SIZE (1 + 4 + 8 + 4 + 4 + PROFILER_HIST_SIZE * 2)
+#define PROFILER_DUMP_SIZE  (2 + 1 + 1 + 4 + 1 + PROF_MAX * PROFILER_ENTRY_SIZE + 1)
+
+/*
+ * @brief    
+ */
+static profEntry_t profilerTable[PROF_MAX] CCM_BSS;
+
+/*
+ * @brief ø   
+ */
+static struct {
+	uint32_t start;
+	uint32_t childCycles; //    Ŭ
+} profilerStack[PROFILER_DEPTH] CCM_BSS;
+static volatile uint8_t profilerDepth = 0;
+static uint8_t profilerMaxDepth = 0;
+
+/*
+ * @brief  
+ * @note uartWrite CPU ۽ ۿ ϹǷ CCM ֵ 
+ */
+static uint8_t profilerDumpBuf[PROFILER_DUMP_SIZE] CCM_BSS;
+
+/*
+ * @brief   
+ * @note ͷƮ ߰    ʵ ª ͷƮ 
+ * @param 
+ * @retval 
+ */
+void profilerEnter(void) {
+	const uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	const uint8_t depth = profilerDepth;
+	if(depth < PROFILER_DEPTH) {
+		profilerStack[depth].childCycles = 0;
+		profilerStack[depth].start = cycles();
+	}
+	profilerDepth = depth + 1;
+	if(profilerDepth > profilerMaxDepth) {
+		profilerMaxDepth = profilerDepth;
+	}
+	__set_PRIMASK(primask);
+}
+
+/*
+ * @brief   ,  
+ * @note  ð ͷƮ  ڿ ,     ͷƮ ð childCycles  self (ħ) 
+ * @param id:   ü
+ * @retval 
+ */
+void profilerExit(profId_t id) {
+	const uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	const uint32_t now = cycles(); //  ڿ о  ͷƮ ð ڽ ð 
+	const uint8_t depth = --profilerDepth;
+	if(depth < PROFILER_DEPTH) {
+		const uint32_t total = now - profilerStack[depth].start;
+		const uint32_t self = total - profilerStack[depth].childCycles;
+		if(depth > 0) {
+			profilerStack[depth - 1].childCycles += total;
+		}
+
+		profEntry_t* entry = &profilerTable[id];
+		entry->count++;
+		entry->totalCycles += self;
+		if(self > entry->maxCycles) {
+			entry->maxCycles = self;
+		}
+		if(profilerStack[depth].childCycles != 0) {
+			entry->nestedCount++;
+		}
+		uint8_t bucket = 32 - __CLZ(self);
+		if(bucket >= PROFILER_HIST_SIZE) {
+			bucket = PROFILER_HIST_SIZE - 1;
+		}
+		if(entry->histogram[bucket] != 0xffff) {
+			entry->histogram[bucket]++;
+		}
+	}
+	__set_PRIMASK(primask);
+}
+
+/*
+ * @brief    б
+ * @param id:   ü
+ * @param entry: ͸  ü 
+ * @retval 
+ */
+void profilerGetEntry(profId_t id, profEntry_t* entry) {
+	const uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	*entry = profilerTable[id];
+	__set_PRIMASK(primask);
+}
+
+/*
+ * @brief   ʱȭ
+ * @param 
+ * @retval 
+ */
+void profilerReset(void) {
+	uint8_t i, j;
+	for(i = 0; i < PROF_MAX; i++) {
+		const uint32_t primask = __get_PRIMASK();
+		__disable_irq();
+		profilerTable[i].count = 0;
+		profilerTable[i].totalCycles = 0;
+		profilerTable[i].maxCycles = 0;
+		profilerTable[i].nestedCount = 0;
+		for(j = 0; j < PROFILER_HIST_SIZE; j++) {
+			profilerTable[i].histogram[j] = 0;
+		}
+		__set_PRIMASK(primask);
+	}
+	profilerMaxDepth = profilerDepth;
+}
+
+/*
+ * @brief Ʋ ۿ 
+ * @param buf:  
+ * @param value: 
+ * @param len: Ʈ 
+ * @retval   ġ
+ */
+static uint8_t* profilerPut(uint8_t* buf, uint64_t value, uint8_t len) {
+	while(len--) {
+		*buf++ = (uint8_t)value;
+		value >>= 8;
+	}
+	return buf;
+}
+
+/*
+ * @brief  ø ̳ʸ 
+ * @note (Ʋ): 0xa5 0x5a, (1), ׸(1), ýŬ(4), ִø(1)
+ * 		  ׸񸶴 id(1), count(4), total(8), max(4), nested(4), histogram(2 * PROFILER_HIST_SIZE)
+ * 		     xor üũ(1), ȣ    
+ * @param 
+ * @retval 
+ */
+void profilerDump(void) {
+	uint8_t* buf = profilerDumpBuf;
+	uint8_t* countPtr;
+	uint8_t count = 0;
+	uint8_t i, j;
+
+	*buf++ = PROFILER_SYNC_1;
+	*buf++ = PROFILER_SYNC_2;
+	*buf++ = PROFILER_VERSION;
+	countPtr = buf++;
+	buf = profilerPut(buf, getSystemClock(), 4);
+	*buf++ = profilerMaxDepth;
+
+	for(i = 0; i < PROF_MAX; i++) {
+		profEntry_t entry;
+		profilerGetEntry(i, &entry);
+		if(entry.count == 0) {
+			continue;
+		}
+		*buf++ = i;
+		buf = profilerPut(buf, entry.count, 4);
+		buf = profilerPut(buf, entry.totalCycles, 8);
+		buf = profilerPut(buf, entry.maxCycles, 4);
+		buf = profilerPut(buf, entry.nestedCount, 4);
+		for(j = 0; j < PROFILER_HIST_SIZE; j++) {
+			buf = profilerPut(buf, entry.histogram[j], 2);
+		}
+		count++;
+	}
+	*countPtr = count;
+
+	uint8_t checksum = 0;
+	uint8_t* p;
+	for(p = profilerDumpBuf + 2; p < buf; p++) {
+		checksum ^= *p;
+	}
+	*buf++ = checksum;
+
+	serialWrite(profilerDumpBuf, buf - profilerDumpBuf);
+}
+
+/*
+ * @brief ø  ó
+ * @note   ȣ, ø  ͸ Һ
+ * 		  'P':  , 'R':   ʱȭ
+ * @param 
+ * @retval 
+ */
+void profilerUpdate(void) {
+	while(serialAvailable()) {
+		switch(serialGetChar()) {
+		case PROFILER_CMD_DUMP:
+			profilerDump();
+			break;
+		case PROFILER_CMD_RESET:
+			profilerReset();
+			break;
+		default:
+			break;
+		}
+	}
+}
@@ -0,0 +1,70 @@
+#ifndef _PROFILER_H_
+#define _PROFILER_H_
+
+#include <system.h>
+
+/*
+ * @brief Ϸ  , 0 ϸ   ũΰ 
+ */
+#ifndef PROFILER_ENABLE
+#define PROFILER_ENABLE 1
+#endif
+
+#define PROFILER_DEPTH      8  // ִ ø 
+#define PROFILER_HIST_SIZE  16 // ׷ ĭ , n° ĭ 2^(n-1) ~ 2^n - 1 Ŭ
+#define PROFILER_CMD_DUMP   'P'
+#define PROFILER_CMD_RESET  'R'
+
+/*
+ * @brief   ü
+ * @note tools/profview.py ̸ ϰ  
+ */
+typedef enum {
+	PROF_SYSTICK = 0,
+	PROF_UART,
+	PROF_I2C_EV,
+	PROF_I2C_ER,
+	PROF_EXTI,
+	PROF_PWM,
+	PROF_TIMER,
+	PROF_PPM,
+	PROF_DSHOT,
+	PROF_USER_0, //  Լ
+	PROF_USER_1,
+	PROF_USER_2,
+	PROF_USER_3,
+	PROF_USER_4,
+	PROF_USER_5,
+	PROF_USER_6,
+	PROF_USER_7,
+	PROF_MAX,
+} profId_t;
+
+/*
+ * @brief    
+ * @note ð  Ŭ , ʿ ø  ( ͷƮ )  ڱ ð
+ */
+typedef struct {
+	uint32_t count;
+	uint64_t totalCycles;
+	uint32_t maxCycles;
+	uint32_t nestedCount; // ߿ ٸ    Ƚ
+	uint16_t histogram[PROFILER_HIST_SIZE];
+} profEntry_t;
+
+#if PROFILER_ENABLE
+#define PROFILE_ENTER()   profilerEnter()
+#define PROFILE_EXIT(id)  profilerExit(id)
+#else
+#define PROFILE_ENTER()   ((void)0)
+#define PROFILE_EXIT(id)  ((void)0)
+#endif
+
+void profilerEnter(void);
+void profilerExit(profId_t id);
+void profilerGetEntry(profId_t id, profEntry_t* entry);
+void profilerReset(void);
+void profilerDump(void);
+void profilerUpdate(void);
+
+#endif
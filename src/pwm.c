@@ -1,9 +1,13 @@
 #include <stm32f4xx.h>
 #include <stm32f4xx_conf.h>
 #include <drv_exti.h>
+#include <drv_timer.h>
 #include <pwm.h>
 #include <rc.h>
 #include <system.h>
+#include <profiler.h>
+#include <seqlock.h>
+#include <ccm.h>
 
 #ifndef bool
 typedef uint8_t bool;
@@ -12,50 +16,124 @@ typedef uint8_t bool;
 #define NULL ((void *)0)
 #endif
 
-static volatile uint32_t rcRising[RC_CHANNEL_MAX] = {0, };
-static volatile uint32_t rcFalling[RC_CHANNEL_MAX] = {0, };
-static volatile uint16_t rcRawData[RC_CHANNEL_MAX] = {1000, 1000, 1000, 1000, 1000};
-static volatile bool rcDataVaild[RC_CHANNEL_MAX] = {true, true, true, true, true};
+/*
+ * @brief pwm ϵ ,  ǿ ѹ 
+ */
+const pwmExtiMap_t pwmExtiMap[MAX_PWM] = {
+	{ .a = BOARD_PWM1_EXTI },
+	{ .a = BOARD_PWM2_EXTI },
+};
+const pwmTimerMap_t pwmTimerMap[MAX_PWM] = {
+	{ .a = BOARD_PWM1_TIMER },
+	{ .a = BOARD_PWM2_TIMER },
+};
 
-static const extiDevice_t* extiChannel = NULL; //NULL
+static volatile uint32_t rcRising[RC_CHANNEL_MAX] = {0, }; //ܺͷƮ ¿ ð, cycles 
+static volatile uint16_t rcRisingCapture[RC_CHANNEL_MAX] = {0, }; //Էĸó ¿ ð, 1us 
+
+/*
+ * @brief ä  
+ * @note pwmWork ͷƮ ġ, ĥ ü pwmSnapshot 
+ * 		  äθ ͷƮ ٸ  켱 Ƽ   Ƿ   ϳ
+ */
+#define PWM_SNAPSHOT_INIT { .channel = {1000, 1000, 1000, 1000, 1000}, .channelCount = RC_CHANNEL_MAX }
+static rcSnapshot_t pwmWork = PWM_SNAPSHOT_INIT;
+static rcSnapshot_t pwmSnapshot[2] = { PWM_SNAPSHOT_INIT, PWM_SNAPSHOT_INIT };
+static seqlock_t pwmLock;
+static volatile uint32_t pwmChannelTime[RC_CHANNEL_MAX]; // äκ   ð(micros)
 
-void pwmHandler(extiDevice_t extiDevice);
+/*
+ * @brief ܺͷƮ ݹ ؽƮ, ä ȣ
+ */
+typedef struct {
+	uint8_t channel;
+} pwmExtiContext_t;
+static pwmExtiContext_t pwmExtiContext[RC_CHANNEL_MAX];
+
+/*
+ * @brief  
+ * @note pwmHistory ͷƮ,  pwmRead 
+ */
+static pwmType_t pwmFilterType = PWM_FILTER_DISABLE;
+static uint16_t pwmHistory[RC_CHANNEL_MAX][2] CCM_BSS;  // ߾Ӱ   ΰ ޽
+static int32_t pwmOutput[RC_CHANNEL_MAX] CCM_BSS;       // , 1/256us 
+static uint16_t pwmTarget[RC_CHANNEL_MAX] CCM_BSS;      //  ǥ
+static int32_t pwmStart[RC_CHANNEL_MAX] CCM_BSS;        //  ۰, 1/256us 
+static uint32_t pwmStartTime[RC_CHANNEL_MAX] CCM_BSS;   //   ð
+static bool pwmFilterReady = false;
+
+static void pwmHandler(void* context, uint32_t entry, bool level);
+static void pwmCaptureHandler(uint8_t channel, uint16_t capture, bool rising);
 
 /*
  * @brief pwm ʱȭ
- * @note   κ  , ÷׸  ϵ..
  * @param extiDevicePtr: ܺͷƮ ġ 
  * @param type: ű ʱȭ  ü
  * @retval 
  */
 void pwmInit(const extiDevice_t* extiDevicePtr, pwmType_t type) {
-	extiChannel = extiDevicePtr; // ű ä 
+	pwmFilterType = type;
 	uint8_t i = 0;
-	for(i = 0; i < MAX_EXTI_DEVICE; i++) {
+	for(i = 0; i < RC_CHANNEL_MAX; i++) {
 		if(extiDevicePtr[i] == 0xff) {
 			break;
 		}
 
 		extiDevice_t extiDevice = extiDevicePtr[i];
-		extiChannelMapping(extiDevice, i);
+		pwmExtiContext[i].channel = i;
 
 		extiInitTypeDef_t extiInitStructure;
 		extiInitStructure.Trigger = EXTI_Trigger_Rising_Falling;
 		extiInitStructure.PreemptionPriority = 1; //⺻ 1, 1 ϰ ߿ ͷƮ  Ȳ  
 		extiInitStructure.SubPriority = 1;
 
-		switch(type) {
-		case PWM_FILTER_DISABLE: //  ,   ǵ Ǿ
-			break;
-		case PWM_FILTER_ENABLE:
+		extiInit(extiDevice, &extiInitStructure, pwmHandler, &pwmExtiContext[i]);
+	}
+}
+
+/*
+ * @brief pwm Էĸó ʱȭ
+ * @note  ð Ÿ̸ ĸó Ϳ Ƿ ٸ ͷƮ ص ޽ Ͱ 
+ * @param timerDevicePtr: Ÿ̸ ä ġ 
+ * @param type: ű ʱȭ  ü
+ * @retval 
+ */
+void pwmCaptureInit(const timerDevice_t* timerDevicePtr, pwmType_t type) {
+	pwmFilterType = type;
+	uint8_t i = 0;
+	for(i = 0; i < RC_CHANNEL_MAX; i++) {
+		if(timerDevicePtr[i] == 0xff) {
 			break;
 		}
 
-		extiInit(extiDevice, &extiInitStructure, pwmHandler);
+		timerInitTypeDef_t timerInitStructure;
+		timerInitStructure.preemptionPriority = 1;
+		timerInitStructure.subPriority = 1;
+		timerInitStructure.tickHz = 1000000; //1us
+		timerInitStructure.mode = TIMER_CAPTURE_BOTH_EDGE;
+
+		timerCaptureInit(timerDevicePtr[i], &timerInitStructure, pwmCaptureHandler, i);
 	}
 }
 
-#define LPF_FACTOR 1 //0.4
+/*
+ * @brief ű  б
+ * @note ͷƮ  ʰ   ä  ü 
+ * @param snapshot:   ü 
+ * @retval 
+ */
+void pwmGetSnapshot(rcSnapshot_t* snapshot) {
+	seqlockRead(&pwmLock, pwmSnapshot, snapshot, sizeof(rcSnapshot_t));
+}
+
+/*
+ * @brief ä  ð
+ * @param channel: ű ä
+ * @retval  ޽  ð(micros)
+ */
+uint32_t pwmGetChannelTime(uint8_t channel) {
+	return pwmChannelTime[channel];
+}
 
 /*
  * @brief ű б
@@ -64,43 +142,124 @@ void pwmInit(const extiDevice_t* extiDevicePtr, pwmType_t type) {
  */
 void pwmRead(uint16_t *data) {
 	uint8_t i = 0;
-	static uint16_t preRcData[5] = { 0, }; //    
-	for(;i < RC_CHANNEL_MAX;i++) { //THR~AUX1
-		if(rcDataVaild[i] == true) { //Ͱ ȿ
-			rcDataVaild[i] = false; //  ǥ
-			if(preRcData[i] != 0) { //Լ ó ȣ ʾ 
-				data[i] = LPF_FACTOR * rcRawData[i] + (1 - LPF_FACTOR) * preRcData[i]; //  (Lpf)
+	rcSnapshot_t snapshot;
+	pwmGetSnapshot(&snapshot);
+	if(pwmFilterType == PWM_FILTER_DISABLE) {
+		for(;i < RC_CHANNEL_MAX;i++) { //THR~AUX1
+			data[i] = snapshot.channel[i];
+		}
+		return;
+	}
+
+	const uint32_t now = micros();
+	if(pwmFilterReady == false) { //Լ ó ȣȰ
+		pwmFilterReady = true;
+		for(i = 0; i < RC_CHANNEL_MAX; i++) {
+			pwmTarget[i] = snapshot.channel[i];
+			pwmOutput[i] = (int32_t)snapshot.channel[i] << 8;
+			pwmStart[i] = pwmOutput[i];
+			pwmStartTime[i] = now;
+		}
+	}
+
+	for(i = 0; i < RC_CHANNEL_MAX; i++) {
+		const int32_t target = (int32_t)snapshot.channel[i] << 8;
+		if(pwmFilterType == PWM_FILTER_ENABLE) { //  (Lpf), y += (x - y) * a
+			pwmOutput[i] += ((target - pwmOutput[i]) * PWM_LPF_FACTOR) >> 8;
+		}
+		else { //    ¿ PWM_INTERPOLATE_US   
+			if(snapshot.channel[i] != pwmTarget[i]) {
+				pwmTarget[i] = snapshot.channel[i];
+				pwmStart[i] = pwmOutput[i];
+				pwmStartTime[i] = now;
+			}
+			const uint32_t elapsed = now - pwmStartTime[i];
+			if(elapsed >= PWM_INTERPOLATE_US) {
+				pwmOutput[i] = target;
 			}
-			else { //Լ ó ȣȰ
-				data[i] = rcRawData[i];
+			else {
+				pwmOutput[i] = pwmStart[i] + (int32_t)(((int64_t)(target - pwmStart[i]) * elapsed) / PWM_INTERPOLATE_US);
 			}
-			preRcData[i] = rcRawData[i]; //  
 		}
-		else {
-			data[i] = preRcData[i];
+		data[i] = (pwmOutput[i] + 128) >> 8;
+	}
+}
+
+/*
+ * @brief   ߾Ӱ
+ * @param a, b, c: 
+ * @retval ߾Ӱ
+ */
+static uint16_t pwmMedian3(uint16_t a, uint16_t b, uint16_t c) {
+	const uint16_t lo = (a < b) ? a : b;
+	const uint16_t hi = (a < b) ? b : a;
+	return (c < lo) ? lo : ((c > hi) ? hi : c);
+}
+
+/*
+ * @brief ޽ , 
+ * @param channel: ű ä
+ * @param buf: ޽(us)
+ * @retval 
+ */
+static void pwmStore(uint8_t channel, uint16_t buf) {
+	if(pwmFilterType != PWM_FILTER_DISABLE) { // ¥ Ƣ  , ֱ  ޽ ߾Ӱ
+		const uint16_t raw = buf;
+		if(pwmHistory[channel][0] == 0) { //ó  ̸ ̷ ä
+			pwmHistory[channel][0] = pwmHistory[channel][1] = raw;
 		}
+		buf = pwmMedian3(raw, pwmHistory[channel][0], pwmHistory[channel][1]);
+		pwmHistory[channel][1] = pwmHistory[channel][0];
+		pwmHistory[channel][0] = raw;
+	}
+	if(buf > RC_MIN && buf < RC_MAX) { //  ּҰ ִ밪  ϶,  ̰  쿡  ݿ ʵ ص
+		pwmWork.channel[channel] = buf;
 	}
+	else {
+		(buf <= RC_MIN) ? (pwmWork.channel[channel] = RC_MIN) : ((buf >= RC_MAX) ? (pwmWork.channel[channel] = RC_MAX) : (0));
+	}
+	pwmWork.timeUs = micros();
+	pwmChannelTime[channel] = pwmWork.timeUs;
+	pwmWork.frameCount++;
+	seqlockWrite(&pwmLock, pwmSnapshot, &pwmWork, sizeof(rcSnapshot_t)); //ü ä ѹ 
 }
 
 /*
  * @brief ű ͷƮ ڵ鷯
  * @note ܺͷƮ ڵ鷯 ȣ ڵ鷯
- * @param extiDevice:
+ * 		   ð ͷƮ  ð̶ ġ ٸ ݹ  ðŭ и 
+ * @param context: ä ؽƮ(pwmExtiContext_t) 
+ * @param entry: ͷƮ  ð(cycles)
+ * @param level:    
  * @retval 
  */
-void pwmHandler(extiDevice_t extiDevice){
-	if(GPIO_ReadInputDataBit(extiHardwareMap[extiChannel[extiDevice]].gpio, extiHardwareMap[extiChannel[extiDevice]].pin) == SET) { //rising ϶
-		rcRising[extiDevice] = micros(); //  microʸ 
+static void pwmHandler(void* context, uint32_t entry, bool level) {
+	PROFILE_ENTER();
+	const uint8_t channel = ((const pwmExtiContext_t*)context)->channel;
+	if(level == true) { //rising ϶
+		rcRising[channel] = entry;
 	}
 	else { //falling ϋ
-		rcFalling[extiDevice] = micros();
-		uint16_t buf = rcFalling[extiDevice] - rcRising[extiDevice]; //falling  risingð  pulse ð 
-		if(buf > RC_MIN && buf < RC_MAX) { //  ּҰ ִ밪  ϶,  ̰  쿡  ݿ ʵ ص
-			rcRawData[extiDevice] = buf;
-		}
-		else {
-			(buf <= RC_MIN) ? (rcRawData[extiDevice] = RC_MIN) : ((buf >= RC_MAX) ? (rcRawData[extiDevice] = RC_MAX) : (0));
-		}
-		rcDataVaild[extiDevice] = true; //Ͱ ȿϴ
+		pwmStore(channel, cyclesToMicros(entry - rcRising[channel])); //falling  risingð  pulse ð 
+	}
+	PROFILE_EXIT(PROF_PWM);
+}
+
+/*
+ * @brief Էĸó ڵ鷯
+ * @note Ÿ̸ ͷƮ ڵ鷯 ȣ ڵ鷯, 16Ʈ īͰ ѹ(65ms)   ޽  
+ * @param channel: ű ä
+ * @param capture: ĸó ī (us)
+ * @param rising: ¿ 
+ * @retval 
+ */
+static void pwmCaptureHandler(uint8_t channel, uint16_t capture, bool rising) {
+	PROFILE_ENTER();
+	if(rising == true) {
+		rcRisingCapture[channel] = capture;
+	}
+	else {
+		pwmStore(channel, (uint16_t)(capture - rcRisingCapture[channel]));
 	}
+	PROFILE_EXIT(PROF_PWM);
 }
@@ -2,10 +2,15 @@
 #define _PWM_H_
 
 #include <drv_exti.h>
+#include <drv_timer.h>
+#include <rc.h>
 
 #define RC_MIN 1020
 #define RC_MAX 1980
 
+#define PWM_LPF_FACTOR      64    //    , 1/256 (64 = 0.25), pwmRead θ 
+#define PWM_INTERPOLATE_US  20000 //  ð,  ű  ֱ(50Hz)
+
 /*
  * @brief pwm ġ ü
  */
@@ -23,22 +28,26 @@ typedef struct {
 } pwmExtiMap_t;
 
 /*
- * @brief pwm ϵ 
+ * @brief pwm ϵ ,  board.h
  */
-static const pwmExtiMap_t pwmExtiMap[] = {
-	{ .a = {EXTI_DEVICE_2, EXTI_DEVICE_3, EXTI_DEVICE_4, EXTI_DEVICE_5, EXTI_DEVICE_15, 0xff} },
-	{ .a = {EXTI_DEVICE_12, EXTI_DEVICE_3, EXTI_DEVICE_4, EXTI_DEVICE_5, EXTI_DEVICE_15, 0xff} },
-};
+extern const pwmExtiMap_t pwmExtiMap[MAX_PWM];
 
 /*
- * @brief pwm Ÿ ü
+ * @brief pwm Էĸó ϵ Ÿ ü
  */
-typedef enum {
-	PWM_FILTER_DISABLE = 0,
-	PWM_FILTER_ENABLE,
-} pwmType_t;
+typedef struct {
+	timerDevice_t a[6];
+} pwmTimerMap_t;
+
+/*
+ * @brief pwm Էĸó ϵ ,  board.h
+ */
+extern const pwmTimerMap_t pwmTimerMap[MAX_PWM];
 
 void pwmInit(const extiDevice_t* extiDevicePtr, pwmType_t type);
+void pwmCaptureInit(const timerDevice_t* timerDevicePtr, pwmType_t type);
 void pwmRead(uint16_t *data);
+void pwmGetSnapshot(rcSnapshot_t* snapshot);
+uint32_t pwmGetChannelTime(uint8_t channel);
 
 #endif
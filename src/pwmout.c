@@ -0,0 +1,176 @@
+#include <stm32f4xx.h>
+#include <stm32f4xx_conf.h>
+#include <drv_timer.h>
+#include <motor.h>
+#include <pwmout.h>
+
+/*
+ * @brief ݺ ī ļ ޽ (ns)
+ * @note ī ļ 84MHz(APB1) 168MHz(APB2) Ÿ̸ Ŭ    
+ * 		  귯õ Ƽ Ƿ ޽   ֱ ü 
+ */
+static const struct {
+	uint32_t tickHz;
+	uint32_t minNs;
+	uint32_t maxNs;
+} pwmOutProtocol[] = {
+	{ 1000000,  1000000, 2000000 }, // PWMOUT_STANDARD
+	{ 21000000, 0,       0       }, // PWMOUT_BRUSHED
+	{ 42000000, 125000,  250000  }, // PWMOUT_ONESHOT125
+	{ 42000000, 41667,   83333   }, // PWMOUT_ONESHOT42
+	{ 42000000, 5000,    25000   }, // PWMOUT_MULTISHOT
+};
+
+/*
+ * @brief ¿  Ÿ̸ ,  ƮҶ Ÿ̸Ӹ ѹ UG 
+ */
+static TIM_TypeDef* pwmOutTimer[PWMOUT_TIMER_MAX];
+static uint8_t pwmOutTimerCount = 0;
+static uint8_t pwmOutMotorCount = 0;
+static pwmOutType_t pwmOutType = PWMOUT_STANDARD;
+static uint16_t pwmOutPeriod = 0; // ֱ(ƽ), 귯õ Ƽ 
+static uint32_t pwmOutMinTicks = 0;
+static uint32_t pwmOutRangeTicks = 0;
+
+/*
+ * @brief Ƴα   ʱȭ
+ * @note  Ÿ̸Ӹ   ߰  ѹ Ʈ ̺Ʈ ༭  
+ * @param type:  ü
+ * @param rate:  ļ(Hz),  迭 (pwmOutUpdate ȣ ֱ⸦ )
+ * @param motorCount:  , MOTOR_MAX 
+ * @retval 
+ */
+void pwmOutInit(pwmOutType_t type, uint16_t rate, uint8_t motorCount) {
+	uint8_t i, j;
+	const uint32_t tickHz = pwmOutProtocol[type].tickHz;
+
+	pwmOutType = type;
+	pwmOutMotorCount = motorCount;
+	pwmOutTimerCount = 0;
+
+	switch(type) {
+	case PWMOUT_STANDARD:
+		rate = (rate < PWMOUT_STANDARD_RATE_MIN) ? PWMOUT_STANDARD_RATE_MIN : (rate > PWMOUT_STANDARD_RATE_MAX) ? PWMOUT_STANDARD_RATE_MAX : rate;
+		pwmOutPeriod = tickHz / rate - 1;
+		break;
+	case PWMOUT_BRUSHED:
+		rate = (rate < PWMOUT_BRUSHED_RATE_MIN) ? PWMOUT_BRUSHED_RATE_MIN : (rate > PWMOUT_BRUSHED_RATE_MAX) ? PWMOUT_BRUSHED_RATE_MAX : rate;
+		pwmOutPeriod = tickHz / rate - 1;
+		break;
+	default:
+		pwmOutPeriod = 0xffff; //  Ʈ  1.56ms ٽ 
+		break;
+	}
+	if(type == PWMOUT_BRUSHED) {
+		pwmOutMinTicks = 0;
+		pwmOutRangeTicks = pwmOutPeriod + 1;
+	}
+	else {
+		pwmOutMinTicks = (uint64_t)pwmOutProtocol[type].minNs * tickHz / 1000000000;
+		pwmOutRangeTicks = (uint64_t)(pwmOutProtocol[type].maxNs - pwmOutProtocol[type].minNs) * tickHz / 1000000000;
+	}
+
+	for(i = 0; i < motorCount; i++) {
+		const motorHardwareMap_t* map = &motorHardwareMap[i];
+
+		// Ÿ̸ 
+		for(j = 0; j < pwmOutTimerCount && pwmOutTimer[j] != map->tim; j++);
+		if(j == pwmOutTimerCount) {
+			if(pwmOutTimerCount >= PWMOUT_TIMER_MAX) {
+				pwmOutMotorCount = i;
+				break;
+			}
+			pwmOutTimer[pwmOutTimerCount++] = map->tim;
+		}
+
+		// clock Ȱȭ
+		RCC_AHB1PeriphClockCmd(map->gpioClock, ENABLE);
+		if(timerIsApb2(map->tim)) {
+			RCC_APB2PeriphClockCmd(map->timClock, ENABLE);
+		}
+		else {
+			RCC_APB1PeriphClockCmd(map->timClock, ENABLE);
+		}
+
+		// gpio 
+		GPIO_InitTypeDef GPIO_InitStructure;
+		GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF;
+		GPIO_InitStructure.GPIO_OType = GPIO_OType_PP;
+		GPIO_InitStructure.GPIO_Pin = map->pin;
+		GPIO_InitStructure.GPIO_PuPd = GPIO_PuPd_DOWN;
+		GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
+		GPIO_Init(map->gpio, &GPIO_InitStructure);
+		GPIO_PinAFConfig(map->gpio, map->pinSource, map->gpioAF);
+
+		// º , ó ּҰ
+		TIM_OCInitTypeDef TIM_OCInitStructure;
+		TIM_OCStructInit(&TIM_OCInitStructure);
+		TIM_OCInitStructure.TIM_OCMode = TIM_OCMode_PWM1;
+		TIM_OCInitStructure.TIM_OutputState = TIM_OutputState_Enable;
+		TIM_OCInitStructure.TIM_OutputNState = TIM_OutputNState_Disable;
+		TIM_OCInitStructure.TIM_OCPolarity = TIM_OCPolarity_High;
+		TIM_OCInitStructure.TIM_OCIdleState = TIM_OCIdleState_Reset;
+		TIM_OCInitStructure.TIM_Pulse = pwmOutMinTicks;
+		timerOCInit(map->tim, map->channel, &TIM_OCInitStructure);
+	}
+
+	for(j = 0; j < pwmOutTimerCount; j++) {
+		TIM_TimeBaseInitTypeDef TIM_TimeBaseStructure;
+		TIM_TimeBaseStructInit(&TIM_TimeBaseStructure);
+		TIM_TimeBaseStructure.TIM_Prescaler = timerGetClock(pwmOutTimer[j]) / tickHz - 1;
+		TIM_TimeBaseStructure.TIM_Period = pwmOutPeriod;
+		TIM_TimeBaseStructure.TIM_ClockDivision = TIM_CKD_DIV1;
+		TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_Up;
+		TIM_TimeBaseInit(pwmOutTimer[j], &TIM_TimeBaseStructure);
+		TIM_ARRPreloadConfig(pwmOutTimer[j], ENABLE);
+		if(pwmOutTimer[j] == TIM1 || pwmOutTimer[j] == TIM8) {
+			TIM_CtrlPWMOutputs(pwmOutTimer[j], ENABLE);
+		}
+	}
+
+	// Ÿ̸ӵ ޾ Ѽ  , ͷƮ   · ǵ
+	const uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	for(j = 0; j < pwmOutTimerCount; j++) {
+		pwmOutTimer[j]->EGR = TIM_EventSource_Update;
+		pwmOutTimer[j]->CR1 |= TIM_CR1_CEN;
+	}
+	__set_PRIMASK(primask);
+}
+
+/*
+ * @brief  ° 
+ * @note CCR ε忡 Ƿ  Ʈ ̺Ʈ(ֱ  Ǵ pwmOutUpdate) ݿ
+ * @param motor:  ȣ
+ * @param value: PWMOUT_VALUE_MIN ~ PWMOUT_VALUE_MAX
+ * @retval 
+ */
+void pwmOutWrite(uint8_t motor, uint16_t value) {
+	if(motor >= pwmOutMotorCount) {
+		return;
+	}
+	value = (value < PWMOUT_VALUE_MIN) ? PWMOUT_VALUE_MIN : (value > PWMOUT_VALUE_MAX) ? PWMOUT_VALUE_MAX : value;
+	const motorHardwareMap_t* map = &motorHardwareMap[motor];
+	(&map->tim->CCR1)[map->channel >> 2] = pwmOutMinTicks + (value - PWMOUT_VALUE_MIN) * pwmOutRangeTicks / (PWMOUT_VALUE_MAX - PWMOUT_VALUE_MIN);
+}
+
+/*
+ * @brief    Ʈ
+ * @note  迭   ڸ ȣϸ  ֱ⸦ ٸ ʰ ٷ ޽ 
+ * 		   Ÿ̸ UG ͷƮ  ޾ ༭ Ÿ̸  ߳  Ŭ ̳
+ * 		   ֱ (Ĵٵ, 귯õ) ֱⰡ ߸ ʵ ƹ͵ 
+ * @param 
+ * @retval 
+ */
+void pwmOutUpdate(void) {
+	uint8_t j;
+	if(pwmOutType == PWMOUT_STANDARD || pwmOutType == PWMOUT_BRUSHED) {
+		return;
+	}
+	const uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	for(j = 0; j < pwmOutTimerCount; j++) {
+		pwmOutTimer[j]->EGR = TIM_EventSource_Update;
+	}
+	__set_PRIMASK(primask);
+}
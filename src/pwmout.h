@@ -0,0 +1,37 @@
+#ifndef _PWMOUT_H_
+#define _PWMOUT_H_
+
+#include <motor.h>
+
+#ifndef bool
+typedef uint8_t bool;
+#define false (bool) 0
+#define true (bool) 1
+#define NULL ((void *)0)
+#endif
+
+#define PWMOUT_TIMER_MAX         2
+#define PWMOUT_VALUE_MIN         1000 // Է° ,   (us  Ʋ)
+#define PWMOUT_VALUE_MAX         2000
+#define PWMOUT_STANDARD_RATE_MIN 50
+#define PWMOUT_STANDARD_RATE_MAX 490
+#define PWMOUT_BRUSHED_RATE_MIN  500
+#define PWMOUT_BRUSHED_RATE_MAX  32000
+
+/*
+ * @brief Ƴα    ü
+ * @note  迭 ARR ִ ΰ pwmOutUpdate  Ʈ ޽ ٷ 
+ */
+typedef enum {
+	PWMOUT_STANDARD = 0, // 1000 ~ 2000us, 50 ~ 490Hz
+	PWMOUT_BRUSHED,      // Ƽ 0 ~ 100%, 500Hz ~ 32kHz
+	PWMOUT_ONESHOT125,   // 125 ~ 250us
+	PWMOUT_ONESHOT42,    // 42 ~ 84us
+	PWMOUT_MULTISHOT,    // 5 ~ 25us
+} pwmOutType_t;
+
+void pwmOutInit(pwmOutType_t type, uint16_t rate, uint8_t motorCount);
+void pwmOutWrite(uint8_t motor, uint16_t value);
+void pwmOutUpdate(void);
+
+#endif
@@ -2,7 +2,13 @@
 #include <stm32f4xx_conf.h>
 #include <drv_uart.h>
 #include <pwm.h>
+#include <ppm.h>
+#include <sbus.h>
+#include <serialrx.h>
+#include <crsf.h>
+#include <ibus.h>
 #include <rc.h>
+#include <system.h>
 
 #ifndef bool
 typedef uint8_t bool;
@@ -21,6 +27,25 @@ static const extiDevice_t* rcExtiDevicePtr = NULL; // NULL
  */
 static rcType_t rcType = 0;
 
+/*
+ * @brief ű Է , rcInit 
+ * @note 0 ä  ⺻( ) 
+ */
+static rcInputConfig_t rcInput;
+
+/*
+ * @brief ȣ  Ǵ 
+ * @note rcRead ϰ rcGetState   ȯ
+ */
+static rcFailsafeConfig_t rcFailsafe;
+static volatile rcState_t rcState = RC_STATE_FAILSAFE; // ó ͸ ޱ  ȣ 
+static volatile uint32_t rcSignalAge = 0xffffffff;
+static uint32_t rcChannelTime[RC_CHANNEL_MAX];  //   ä  ð
+static bool rcChannelStale[RC_CHANNEL_MAX] = {true, true, true, true, true}; // ð ٲ𶧱  , micros ѹ Ƶ Ƴ ʰ
+static bool rcChannelSeen[RC_CHANNEL_MAX];     // ѹ̶ ŵ ä,   pwm ä Ǵܿ 
+static uint32_t rcRecoverStart = 0;
+static bool rcRecovering = false;
+
 /*
  * @brief ű ʱȭ
  * @param rcDevice: ű ġ ü
@@ -29,31 +54,253 @@ static rcType_t rcType = 0;
  */
 void rcInit(rcDevice_t rcDevice, rcType_t type) { // rcDevice
 	rcType = type; // PWM, PPM
+	if(rcFailsafe.failsafeUs == 0) { // rcFailsafeConfig  ʾ ⺻
+		rcFailsafeStructInit(&rcFailsafe);
+	}
 	rcExtiDevicePtr = pwmExtiMap[rcDevice].a; // a[] = { EXTI1, TIM2, TIM3, TIM4 }, pointer value
 	switch(rcType) {
 	case PWM:
-		pwmInit(rcExtiDevicePtr, PWM_FILTER_DISABLE);
+		pwmInit(rcExtiDevicePtr, rcInput.pwmFilter);
+		break;
+	case PWM_CAPTURE:
+		pwmCaptureInit(pwmTimerMap[rcDevice].a, rcInput.pwmFilter);
 		break;
 	case PPM:
+		ppmInit(pwmTimerMap[rcDevice].a[0]); // ù° Էĸó ä ϳ 
 		break;
 	case S_BUS:
+		sbusInit(serialRxUartMap[rcDevice]);
+		break;
+	case CRSF:
+		serialRxInit(serialRxUartMap[rcDevice], &crsfProtocol);
 		break;
+	case IBUS:
+		serialRxInit(serialRxUartMap[rcDevice], &ibusProtocol);
+		break;
+	}
+}
+
+/*
+ * @brief ä  ð
+ * @note pwm äθ ͷƮ  ð,   ð
+ * @param snapshot:  
+ * @param channel: ű ä
+ * @retval ð(micros)
+ */
+static uint32_t rcGetChannelTime(const rcSnapshot_t* snapshot, uint8_t channel) {
+	switch(rcType) {
+	case PWM:
+	case PWM_CAPTURE:
+		return pwmGetChannelTime(channel);
+	default:
+		return snapshot->timeUs;
+	}
+}
+
+/*
+ * @brief ȣ  Ǵ
+ * @note ѹ̶ ŵ ä    ŵ  ä  ð ¸ 
+ * 		    pwm ä   FAILSAFE  ʰ , ŵ ä ϳ  FAILSAFE
+ * 		  OK/HOLD -> FAILSAFE , FAILSAFE -> OK recoverUs   ϶
+ * @param 
+ * @retval 
+ */
+static void rcFailsafeUpdate(void) {
+	rcSnapshot_t snapshot;
+	rcGetSnapshot(&snapshot);
+	const uint32_t now = micros();
+	uint32_t age = 0;
+	bool seen = false;
+	uint8_t i;
+	for(i = 0; i < RC_CHANNEL_MAX; i++) {
+		const uint32_t time = rcGetChannelTime(&snapshot, i);
+		if(snapshot.frameCount != 0 && time != rcChannelTime[i]) { // 
+			rcChannelTime[i] = time;
+			rcChannelStale[i] = false;
+			rcChannelSeen[i] = true;
+		}
+		if(rcChannelSeen[i] == false) {
+			continue;
+		}
+		seen = true;
+		uint32_t channelAge = now - rcChannelTime[i];
+		if(rcChannelStale[i] == true || channelAge >= rcFailsafe.failsafeUs) {
+			rcChannelStale[i] = true;
+			channelAge = 0xffffffff;
+		}
+		if(channelAge > age) {
+			age = channelAge;
+		}
+	}
+	if(seen == false) {
+		age = 0xffffffff;
+	}
+	rcSignalAge = age;
+
+	if(age >= rcFailsafe.failsafeUs) {
+		rcState = RC_STATE_FAILSAFE;
+		rcRecovering = false;
+	}
+	else if(age >= rcFailsafe.holdUs) {
+		if(rcState != RC_STATE_FAILSAFE) {
+			rcState = RC_STATE_HOLD;
+		}
+		rcRecovering = false;
+	}
+	else if(rcState == RC_STATE_FAILSAFE) {
+		if(rcRecovering == false) {
+			rcRecovering = true;
+			rcRecoverStart = now;
+		}
+		else if(now - rcRecoverStart >= rcFailsafe.recoverUs) {
+			rcState = RC_STATE_OK;
+			rcRecovering = false;
+		}
+	}
+	else {
+		rcState = RC_STATE_OK;
 	}
 }
 
 /*
  * @brief ű б
+ * @note HOLD ¿ ű ʿ   ״ , FAILSAFE ¿   ٲ
  * @param data: 5  ȯ  
  * @retval 
  */
 void rcRead(uint16_t *data) {
 	switch(rcType) {
 	case PWM:
+	case PWM_CAPTURE:
 		pwmRead(data);
 		break;
 	case PPM:
+		ppmRead(data);
+		break;
+	case S_BUS:
+		sbusRead(data);
+		break;
+	case CRSF:
+	case IBUS:
+		serialRxRead(data);
+		break;
+	}
+	rcFailsafeUpdate();
+	if(rcState == RC_STATE_FAILSAFE) {
+		uint8_t i;
+		for(i = 0; i < RC_CHANNEL_MAX; i++) {
+			data[i] = rcFailsafe.failsafeValue[i];
+		}
+	}
+}
+
+/*
+ * @brief   ó,   ȣ
+ * @note ø ű ⼭(Ǵ rcRead)  ڵؼ 
+ * 		  pwm, ppm ͷƮ ϹǷ   
+ * @param 
+ * @retval 
+ */
+void rcUpdate(void) {
+	switch(rcType) {
+	case S_BUS:
+		sbusUpdate();
+		break;
+	case CRSF:
+	case IBUS:
+		serialRxUpdate();
+		break;
+	default:
+		break;
+	}
+}
+
+/*
+ * @brief ű  б
+ * @note ͷƮ  ʰ   ä  ü , ͷƮ ȣص 
+ * @param snapshot:   ü 
+ * @retval 
+ */
+void rcGetSnapshot(rcSnapshot_t* snapshot) {
+	switch(rcType) {
+	case PWM:
+	case PWM_CAPTURE:
+		pwmGetSnapshot(snapshot);
+		break;
+	case PPM:
+		ppmGetSnapshot(snapshot);
 		break;
 	case S_BUS:
+		sbusGetSnapshot(snapshot);
+		break;
+	case CRSF:
+	case IBUS:
+		serialRxGetSnapshot(snapshot);
 		break;
 	}
 }
+
+/*
+ * @brief ű Է  ü ⺻
+ * @note  
+ * @param config:  ü 
+ * @retval 
+ */
+void rcInputStructInit(rcInputConfig_t* config) {
+	config->pwmFilter = PWM_FILTER_DISABLE;
+}
+
+/*
+ * @brief ű Է 
+ * @note rcInit  θ, ʱȭҶ 
+ * @param config:  ü 
+ * @retval 
+ */
+void rcInputConfig(const rcInputConfig_t* config) {
+	rcInput = *config;
+}
+
+/*
+ * @brief ȣ   ü ⺻
+ * @note HOLD 100ms, FAILSAFE 1s,  200ms, Ʋ AUX1 ּ,  ߾
+ * @param config:  ü 
+ * @retval 
+ */
+void rcFailsafeStructInit(rcFailsafeConfig_t* config) {
+	config->holdUs = 100000;
+	config->failsafeUs = 1000000;
+	config->recoverUs = 200000;
+	config->failsafeValue[THR] = RC_MIN;
+	config->failsafeValue[AIL] = 1500;
+	config->failsafeValue[ELE] = 1500;
+	config->failsafeValue[RUD] = 1500;
+	config->failsafeValue[AUX1] = RC_MIN;
+}
+
+/*
+ * @brief ȣ  
+ * @param config:  ü 
+ * @retval 
+ */
+void rcFailsafeConfig(const rcFailsafeConfig_t* config) {
+	rcFailsafe = *config;
+}
+
+/*
+ * @brief  
+ * @note rcRead  Ǵ 
+ * @param 
+ * @retval   ü
+ */
+rcState_t rcGetState(void) {
+	return rcState;
+}
+
+/*
+ * @brief ѹ̶ ŵ ä    ŵ  ä  ð
+ * @param 
+ * @retval ũ,  ä ְų ŵ ä  0xffffffff
+ */
+uint32_t rcGetSignalAge(void) {
+	return rcSignalAge;
+}
@@ -29,9 +29,73 @@ typedef enum {
 	PWM = 0,
 	PPM,
 	S_BUS,
+	PWM_CAPTURE, // Ÿ̸ Էĸó pwm 
+	CRSF,
+	IBUS,
 } rcType_t;
 
+#define RC_SNAPSHOT_CHANNEL_MAX 16
+
+/*
+ * @brief ű  ü
+ * @note   ä  ü,   ǹǷ äγ  
+ */
+typedef struct {
+	uint16_t channel[RC_SNAPSHOT_CHANNEL_MAX]; // us
+	uint8_t channelCount;
+	uint32_t timeUs;     //  ð(micros)
+	uint32_t frameCount; // Ҷ , 0̸    
+} rcSnapshot_t;
+
+/*
+ * @brief   ü
+ * @note OK: , HOLD:  ,   , FAILSAFE: ȣ ,   
+ */
+typedef enum {
+	RC_STATE_OK = 0,
+	RC_STATE_HOLD,
+	RC_STATE_FAILSAFE,
+} rcState_t;
+
+/*
+ * @brief pwm Ÿ ü, pwm.h   ϹǷ ű (rcInputConfig_t)  ⿡ 
+ * @note 50Hz ű, pwmRead 1kHz ȣ, 3us  (90%  ð / 1ms  ȭ rms /   +150us ũ)
+ * 		  DISABLE: 0ms / 0.60us / 150us, ENABLE: 28ms / 0.21us / , INTERPOLATE: 38ms / 0.22us / 
+ * 		   test/test_pwm.c(make -C test)
+ * 		  ߾Ӱ  (20ms)  
+ */
+typedef enum {
+	PWM_FILTER_DISABLE = 0,
+	PWM_FILTER_ENABLE,      // ߾Ӱ +   
+	PWM_FILTER_INTERPOLATE, // ߾Ӱ +   
+} pwmType_t;
+
+/*
+ * @brief ű Է  ü
+ */
+typedef struct {
+	pwmType_t pwmFilter; // PWM, PWM_CAPTURE Է 
+} rcInputConfig_t;
+
+/*
+ * @brief ȣ  Ǵ  ü, ũ 
+ */
+typedef struct {
+	uint32_t holdUs;     // ŵ  ִ ä    ä  ð  ŵ  HOLD
+	uint32_t failsafeUs; //  ð  ŵ  FAILSAFE
+	uint32_t recoverUs;  // FAILSAFE  ð   ̾ OK ư
+	uint16_t failsafeValue[RC_CHANNEL_MAX];
+} rcFailsafeConfig_t;
+
 void rcInit(rcDevice_t rcDevice, rcType_t type);
 void rcRead(uint16_t *data);
+void rcUpdate(void);
+void rcGetSnapshot(rcSnapshot_t* snapshot);
+void rcInputStructInit(rcInputConfig_t* config);
+void rcInputConfig(const rcInputConfig_t* config);
+void rcFailsafeStructInit(rcFailsafeConfig_t* config);
+void rcFailsafeConfig(const rcFailsafeConfig_t* config);
+rcState_t rcGetState(void);
+uint32_t rcGetSignalAge(void);
 
 #endif
@@ -0,0 +1,178 @@
+#include <stm32f4xx.h>
+#include <stm32f4xx_conf.h>
+#include <drv_uart.h>
+#include <pwm.h>
+#include <rc.h>
+#include <sbus.h>
+#include <seqlock.h>
+#include <system.h>
+
+/*
+ * @brief  Ʈ ġ
+ */
+static uartDevice_t sbusUart = 0;
+
+/*
+ * @brief  
+ */
+static uint8_t sbusFrame[SBUS_FRAME_SIZE];
+static uint8_t sbusFrameIndex = 0;
+
+/*
+ * @brief ڵ 
+ * @note sbusWork sbusUpdate ȣϴ ʿ ġ Ӹ   
+ * 		  ͷƮ    
+ */
+static rcSnapshot_t sbusWork;
+static rcSnapshot_t sbusSnapshot[2];
+static seqlock_t sbusLock;
+static bool sbusFailsafe = true; // ù  ޱ  ȣ 
+static uint32_t sbusLostCount = 0;
+
+/*
+ * @brief S.BUS ʱȭ
+ * @note 100000bps 8E2,  ȣ,  DMA Ƿ Ʈ ͷƮ ɸ 
+ * @param uartDevice: Ʈ ġ ü
+ * @retval 
+ */
+void sbusInit(uartDevice_t uartDevice) {
+	sbusUart = uartDevice;
+
+	uartInitTypeDef_t uartInitStructure;
+	uartStructInit(&uartInitStructure);
+	uartInitStructure.preemptionPriority = 1;
+	uartInitStructure.subPriority = 1;
+	uartInitStructure.baudRate = SBUS_BAUDRATE;
+	uartInitStructure.parity = USART_Parity_Even;
+	uartInitStructure.stopBits = USART_StopBits_2;
+	uartInitStructure.inverted = true;
+	uartInitStructure.rxDma = true;
+	uartInit(uartDevice, &uartInitStructure);
+}
+
+/*
+ * @brief 11Ʈ ä  Ǯ
+ * @note ä i   11 * i° Ʈ 11Ʈ, Ʋ, CRSF  
+ * 		   Ʈ ٿ Ʈ ũ Ƿ äθ бⰡ 
+ * 		  172 ~ 1811 -> 988 ~ 2012us (x * 5 / 8 + 880)
+ * @param data: 22Ʈ ä 
+ * @param channel: 16 ä (us) ȯ  
+ * @retval 
+ */
+void sbusUnpack(const uint8_t* data, uint16_t* channel) {
+	uint8_t i;
+	for(i = 0; i < SBUS_CHANNEL_MAX; i++) {
+		const uint16_t bit = i * 11;
+		const uint8_t* p = data + (bit >> 3);
+		const uint32_t raw = ((uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16)) >> (bit & 7);
+		channel[i] = (((raw & 0x7ff) * 5) >> 3) + 880;
+	}
+}
+
+/*
+ * @brief ϼ  ó
+ * @note failsafe frame lost ÷װ   űⰡ   ݺ ̹Ƿ ä  
+ * @param frame: 25Ʈ 
+ * @retval 
+ */
+static void sbusProcessFrame(const uint8_t* frame) {
+	const uint8_t flags = frame[23];
+	if(flags & SBUS_FLAG_FAILSAFE) {
+		sbusFailsafe = true;
+	}
+	else if(flags & SBUS_FLAG_LOST) {
+		sbusLostCount++;
+	}
+	else {
+		sbusUnpack(frame + 1, sbusWork.channel);
+		sbusWork.channelCount = SBUS_CHANNEL_MAX;
+		sbusWork.timeUs = micros();
+		sbusWork.frameCount++;
+		seqlockWrite(&sbusLock, sbusSnapshot, &sbusWork, sizeof(rcSnapshot_t));
+		sbusFailsafe = false;
+	}
+}
+
+/*
+ * @brief   ó,   ȣ
+ * @note  Ʈ(0x0f) ⸦  25° Ʈ  Ʈ(S.BUS 0x00, S.BUS2 0x?4)϶  
+ * 		   Ʈ Ʋ  Ʈ ȿ   Ʈ ã ٽ ⸦ 
+ * @param 
+ * @retval 
+ */
+void sbusUpdate(void) {
+	while(uartAvailable(sbusUart)) {
+		const uint8_t c = uartGetChar(sbusUart);
+		if(sbusFrameIndex == 0 && c != SBUS_START_BYTE) {
+			continue;
+		}
+		sbusFrame[sbusFrameIndex++] = c;
+		if(sbusFrameIndex < SBUS_FRAME_SIZE) {
+			continue;
+		}
+
+		if(c == 0x00 || (c & 0x0f) == 0x04) {
+			sbusProcessFrame(sbusFrame);
+			sbusFrameIndex = 0;
+		}
+		else {
+			uint8_t i, j;
+			for(i = 1; i < SBUS_FRAME_SIZE && sbusFrame[i] != SBUS_START_BYTE; i++);
+			for(j = 0; i < SBUS_FRAME_SIZE; i++, j++) {
+				sbusFrame[j] = sbusFrame[i];
+			}
+			sbusFrameIndex = j;
+		}
+	}
+}
+
+/*
+ * @brief ű б
+ * @note  RC_CHANNEL_MAX ä RC_MIN ~ RC_MAX ؼ ȯ,     
+ * @param data: 5  ȯ  
+ * @retval 
+ */
+void sbusRead(uint16_t *data) {
+	sbusUpdate();
+	rcSnapshot_t snapshot;
+	sbusGetSnapshot(&snapshot);
+	uint8_t i = 0;
+	for(; i < RC_CHANNEL_MAX && i < snapshot.channelCount; i++) {
+		uint16_t buf = snapshot.channel[i];
+		if(buf < RC_MIN) {
+			buf = RC_MIN;
+		}
+		else if(buf > RC_MAX) {
+			buf = RC_MAX;
+		}
+		data[i] = buf;
+	}
+}
+
+/*
+ * @brief ű  б
+ * @note 16 ä ü,   us , ͷƮ  ʰ   ü 
+ * @param snapshot:   ü 
+ * @retval 
+ */
+void sbusGetSnapshot(rcSnapshot_t* snapshot) {
+	seqlockRead(&sbusLock, sbusSnapshot, snapshot, sizeof(rcSnapshot_t));
+}
+
+/*
+ * @brief failsafe 
+ * @param 
+ * @retval űⰡ failsafe °ų     true
+ */
+bool sbusGetFailsafe(void) {
+	return sbusFailsafe;
+}
+
+/*
+ * @brief frame lost ÷װ   
+ * @param 
+ * @retval  
+ */
+uint32_t sbusGetLostCount(void) {
+	return sbusLostCount;
+}
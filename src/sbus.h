@@ -0,0 +1,24 @@
+#ifndef _SBUS_H_
+#define _SBUS_H_
+
+#include <drv_uart.h>
+#include <rc.h>
+
+#define SBUS_BAUDRATE       100000
+#define SBUS_FRAME_SIZE     25
+#define SBUS_CHANNEL_MAX    16
+#define SBUS_START_BYTE     0x0f
+#define SBUS_FLAG_CH17      (1 << 0)
+#define SBUS_FLAG_CH18      (1 << 1)
+#define SBUS_FLAG_LOST      (1 << 2) // űⰡ  ħ
+#define SBUS_FLAG_FAILSAFE  (1 << 3) // űⰡ ۽ű ȣ 
+
+void sbusInit(uartDevice_t uartDevice);
+void sbusUnpack(const uint8_t* data, uint16_t* channel);
+void sbusUpdate(void);
+void sbusRead(uint16_t *data);
+void sbusGetSnapshot(rcSnapshot_t* snapshot);
+bool sbusGetFailsafe(void);
+uint32_t sbusGetLostCount(void);
+
+#endif
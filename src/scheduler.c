@@ -0,0 +1,271 @@
+#include <stm32f4xx.h>
+#include <stm32f4xx_conf.h>
+#include <scheduler.h>
+#include <system.h>
+#include <drv_timer.h>
+#include <ccm.h>
+
+#ifndef bool
+typedef uint8_t bool;
+#define false (bool) 0
+#define true (bool) 1
+#define NULL ((void *)0)
+#endif
+
+/*
+ * @brief ۾ ü
+ */
+typedef struct {
+	taskFuncPtr_t func;
+	uint32_t periodUs;
+	taskPriority_t priority;
+	uint32_t nextTime; //    ð(micros)
+
+	uint32_t runCount;
+	uint64_t totalExecUs;
+	uint32_t maxExecUs;
+	uint64_t totalJitterUs;
+	uint32_t maxJitterUs;
+	uint32_t lateCount;
+} task_t;
+
+/*
+ * @brief ϵ ۾
+ */
+static task_t tasks[TASK_MAX] CCM_BSS;
+static uint8_t taskCount = 0;
+
+/*
+ * @brief  Ÿ̸, ѹ  ߴ   ۾ ð Ʈ ͷƮ 
+ */
+static TIM_TypeDef* const schedulerTimer = BOARD_FIELD(0, BOARD_SCHEDULER_TIMER);
+static bool schedulerTimerReady = false;
+
+/*
+ * @brief cpu  
+ */
+static uint32_t loadWindowStart = 0;
+static uint32_t loadBusyUs = 0;
+static uint8_t cpuLoad = 0;
+
+/*
+ * @brief  Ÿ̸ ʱȭ
+ * @note   ⺻ Ÿ̸Ӹ SCHEDULER_WAKE_HZ , Ʈ ̺Ʈ ߰ 
+ * @param 
+ * @retval 
+ */
+static void schedulerTimerInit(void) {
+	if(timerIsApb2(schedulerTimer)) {
+		RCC_APB2PeriphClockCmd(BOARD_FIELD(2, BOARD_SCHEDULER_TIMER), ENABLE);
+	}
+	else {
+		RCC_APB1PeriphClockCmd(BOARD_FIELD(2, BOARD_SCHEDULER_TIMER), ENABLE);
+	}
+
+	TIM_TimeBaseInitTypeDef TIM_TimeBaseStructure;
+	TIM_TimeBaseStructInit(&TIM_TimeBaseStructure);
+	TIM_TimeBaseStructure.TIM_Prescaler = timerGetClock(schedulerTimer) / SCHEDULER_WAKE_HZ - 1;
+	TIM_TimeBaseStructure.TIM_Period = 0xffff;
+	TIM_TimeBaseStructure.TIM_ClockDivision = TIM_CKD_DIV1;
+	TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_Up;
+	TIM_TimeBaseInit(schedulerTimer, &TIM_TimeBaseStructure);
+	TIM_SelectOnePulseMode(schedulerTimer, TIM_OPMode_Single);
+
+	NVIC_InitTypeDef NVIC_InitStructure;
+	NVIC_InitStructure.NVIC_IRQChannel = BOARD_FIELD(1, BOARD_SCHEDULER_TIMER);
+	NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = SCHEDULER_NVIC_PRIORITY;
+	NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+	NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+	NVIC_Init(&NVIC_InitStructure);
+
+	TIM_ClearITPendingBit(schedulerTimer, TIM_IT_Update); // TimeBaseInit  Ʈ
+	TIM_ITConfig(schedulerTimer, TIM_IT_Update, ENABLE);
+	schedulerTimerReady = true;
+}
+
+/*
+ * @brief Ŭ ٲ   Ÿ̸ ֺ ٽ 
+ * @note clockConfigure θ
+ * @param 
+ * @retval 
+ */
+void schedulerClockUpdate(void) {
+	if(schedulerTimerReady) {
+		TIM_PrescalerConfig(schedulerTimer, timerGetClock(schedulerTimer) / SCHEDULER_WAKE_HZ - 1, TIM_PSCReloadMode_Immediate);
+	}
+}
+
+/*
+ * @brief  ð 
+ * @note  Ÿ̸Ӹ  ð ɰ WFI, Ÿ̸ӳ ٸ ͷƮ 
+ * 		  ͷƮ  ä Ÿ̸Ӹ ɰ   ̿ Ÿ̸Ӱ  ͷƮ ġ 
+ * 		   ð Ÿ̸     , ٷ ٽ 
+ * @param wakeTime:  ð(micros)
+ * @retval 
+ */
+static void schedulerSleep(uint32_t wakeTime) {
+	const uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	const int32_t wait = (int32_t)(wakeTime - micros());
+	if(wait >= SCHEDULER_SLEEP_MIN_US) {
+		schedulerTimer->ARR = (wait > 0x10000) ? 0xffff : wait - 1; // 0 ARR   ƽ Ʈ
+		schedulerTimer->CNT = 0;
+		schedulerTimer->CR1 |= TIM_CR1_CEN;
+		__WFI();
+		schedulerTimer->CR1 &= ~TIM_CR1_CEN; // ٸ ͷƮ  
+	}
+	__set_PRIMASK(primask);
+}
+
+/*
+ * @brief ۾ 
+ * @note ù   , ó Ҷ  Ÿ̸Ӹ ʱȭ
+ * @param taskFunc: ۾ Լ 
+ * @param periodUs:  ֱ(us)
+ * @param priority: 켱 ü
+ * @retval ۾ ȣ(int8_t),  ڸ  -1
+ */
+int8_t schedulerAddTask(taskFuncPtr_t taskFunc, uint32_t periodUs, taskPriority_t priority) {
+	if(taskCount >= TASK_MAX) {
+		return -1;
+	}
+	if(schedulerTimerReady == false) {
+		schedulerTimerInit();
+	}
+	task_t* task = &tasks[taskCount];
+	task->func = taskFunc;
+	task->periodUs = periodUs;
+	task->priority = priority;
+	task->nextTime = micros();
+	return taskCount++;
+}
+
+/*
+ * @brief ۾ ֱ 
+ * @param taskId: ۾ ȣ
+ * @param periodUs:  ֱ(us)
+ * @retval 
+ */
+void schedulerSetPeriod(uint8_t taskId, uint32_t periodUs) {
+	tasks[taskId].periodUs = periodUs;
+}
+
+/*
+ * @brief ٷ ѹ 
+ * @note    ȣ,  ۾ 켱  (  ) ۾ ϳ  
+ * 		   ۾     ð  Ÿ̸Ӹ ɰ 
+ * @param 
+ * @retval 
+ */
+void schedulerRun(void) {
+	uint32_t now = micros();
+	task_t* selected = NULL;
+	int32_t selectedLate = 0;
+	int32_t minWait = INT32_MAX;
+	uint8_t i;
+
+	for(i = 0; i < taskCount; i++) {
+		task_t* task = &tasks[i];
+		const int32_t late = (int32_t)(now - task->nextTime);
+		if(late >= 0) {
+			if(selected == NULL || task->priority > selected->priority
+					|| (task->priority == selected->priority && late > selectedLate)) {
+				selected = task;
+				selectedLate = late;
+			}
+		}
+		else if(-late < minWait) {
+			minWait = -late;
+		}
+	}
+
+	if(selected == NULL) {
+		if(taskCount > 0) {
+			schedulerSleep(now + minWait);
+		}
+		return;
+	}
+
+	//  ð   ð ؼ ֱⰡ и ʰ ,  ֱ ̻ з ٽ 
+	if((uint32_t)selectedLate >= selected->periodUs) {
+		selected->nextTime = now + selected->periodUs;
+	}
+	else {
+		selected->nextTime += selected->periodUs;
+	}
+
+	selected->func(now);
+	const uint32_t execUs = micros() - now;
+
+	selected->runCount++;
+	selected->totalExecUs += execUs;
+	if(execUs > selected->maxExecUs) {
+		selected->maxExecUs = execUs;
+	}
+	selected->totalJitterUs += selectedLate;
+	if((uint32_t)selectedLate > selected->maxJitterUs) {
+		selected->maxJitterUs = selectedLate;
+	}
+	if((uint32_t)selectedLate * SCHEDULER_LATE_RATIO >= selected->periodUs) {
+		selected->lateCount++;
+	}
+
+	loadBusyUs += execUs;
+	now += execUs;
+	if(now - loadWindowStart >= SCHEDULER_LOAD_WINDOW) {
+		cpuLoad = (uint64_t)loadBusyUs * 100 / (now - loadWindowStart);
+		loadBusyUs = 0;
+		loadWindowStart = now;
+	}
+}
+
+/*
+ * @brief ۾  б
+ * @param taskId: ۾ ȣ
+ * @param stat: 踦  ü 
+ * @retval 
+ */
+void schedulerGetTaskStat(uint8_t taskId, taskStat_t* stat) {
+	const task_t* task = &tasks[taskId];
+	stat->runCount = task->runCount;
+	stat->avgExecUs = task->runCount ? task->totalExecUs / task->runCount : 0;
+	stat->maxExecUs = task->maxExecUs;
+	stat->avgJitterUs = task->runCount ? task->totalJitterUs / task->runCount : 0;
+	stat->maxJitterUs = task->maxJitterUs;
+	stat->lateCount = task->lateCount;
+}
+
+/*
+ * @brief  ۾  ʱȭ
+ * @param 
+ * @retval 
+ */
+void schedulerResetStat(void) {
+	uint8_t i;
+	for(i = 0; i < taskCount; i++) {
+		tasks[i].runCount = 0;
+		tasks[i].totalExecUs = 0;
+		tasks[i].maxExecUs = 0;
+		tasks[i].totalJitterUs = 0;
+		tasks[i].maxJitterUs = 0;
+		tasks[i].lateCount = 0;
+	}
+}
+
+/*
+ * @brief cpu  б
+ * @note SCHEDULER_LOAD_WINDOW  ۾  ð 
+ * @param 
+ * @retval (%)
+ */
+uint8_t schedulerGetCpuLoad(void) {
+	return cpuLoad;
+}
+
+/*
+ * @brief  Ÿ̸ ͷƮ ڵ鷯, ⸸ ϹǷ ÷׸ 
+ * @note ڵ鷯 ̸ board.h BOARD_SCHEDULER_IRQHandler
+ */
+void BOARD_SCHEDULER_IRQHandler(void) {
+	schedulerTimer->SR = (uint16_t)~TIM_SR_UIF;
+}
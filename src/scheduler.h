@@ -0,0 +1,48 @@
+#ifndef _SCHEDULER_H_
+#define _SCHEDULER_H_
+
+#define TASK_MAX                16
+#define SCHEDULER_SLEEP_MIN_US  3    //  ۾ ̺    ʰ , Ÿ̸    
+#define SCHEDULER_WAKE_HZ       1000000 //  Ÿ̸ ī ļ, 1us
+#define SCHEDULER_NVIC_PRIORITY 3
+#define SCHEDULER_LATE_RATIO    4    // ֱ 1/4 ̻ ʰ ϸ  
+#define SCHEDULER_LOAD_WINDOW   1000000 // cpu   (us)
+
+/*
+ * @brief ۾ 켱 ü,  ð  ۾   ͺ
+ */
+typedef enum {
+	TASK_PRIORITY_IDLE = 0,
+	TASK_PRIORITY_LOW,
+	TASK_PRIORITY_MEDIUM,
+	TASK_PRIORITY_HIGH,
+	TASK_PRIORITY_REALTIME,
+} taskPriority_t;
+
+/*
+ * @brief ۾ Լ, ڷ   ð(micros) 
+ */
+typedef void (*taskFuncPtr_t) (uint32_t);
+
+/*
+ * @brief ۾  ü, ũ 
+ * @note ʹ  ð ʰ  ð
+ */
+typedef struct {
+	uint32_t runCount;
+	uint32_t avgExecUs;
+	uint32_t maxExecUs;
+	uint32_t avgJitterUs;
+	uint32_t maxJitterUs;
+	uint32_t lateCount;
+} taskStat_t;
+
+int8_t schedulerAddTask(taskFuncPtr_t taskFunc, uint32_t periodUs, taskPriority_t priority);
+void schedulerSetPeriod(uint8_t taskId, uint32_t periodUs);
+void schedulerRun(void);
+void schedulerClockUpdate(void);
+void schedulerGetTaskStat(uint8_t taskId, taskStat_t* stat);
+void schedulerResetStat(void);
+uint8_t schedulerGetCpuLoad(void);
+
+#endif
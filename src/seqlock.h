@@ -0,0 +1,63 @@
+#ifndef _SEQLOCK_H_
+#define _SEQLOCK_H_
+
+#include <stm32f4xx.h>
+#include <string.h>
+
+/*
+ * @brief ޸ 踮, Ϸ   ٲ ϰ 
+ */
+#ifndef SEQLOCK_BARRIER
+#define SEQLOCK_BARRIER() __asm volatile ("dmb" ::: "memory")
+#endif
+
+/*
+ * @brief  
+ * @note   纻 ΰ ʷ ,  Ȧ  0, ¦  1 
+ * 		  д    Ʈ   ʴ 纻  Ƿ
+ * 		   ߿  ͷƮ о ٸ ʰ ϼ  
+ * 		  д ߿     ٲǷ ٽ , ͷƮ  
+ * 		    ϳ,   켱 ͷƮ   Ƿ ϳ 
+ */
+typedef struct {
+	volatile uint32_t sequence;
+} seqlock_t;
+
+/*
+ * @brief 
+ * @param lock:   
+ * @param copy: 纻 ΰ 迭
+ * @param data:  
+ * @param size:  ũ
+ * @retval 
+ */
+static inline void seqlockWrite(seqlock_t* lock, void* copy, const void* data, uint16_t size) {
+	lock->sequence++;
+	SEQLOCK_BARRIER();
+	memcpy(copy, data, size);
+	SEQLOCK_BARRIER();
+	lock->sequence++;
+	SEQLOCK_BARRIER();
+	memcpy((uint8_t*)copy + size, data, size);
+	SEQLOCK_BARRIER();
+}
+
+/*
+ * @brief б
+ * @param lock:   
+ * @param copy: 纻 ΰ 迭
+ * @param data:  ͸  
+ * @param size:  ũ
+ * @retval 
+ */
+static inline void seqlockRead(const seqlock_t* lock, const void* copy, void* data, uint16_t size) {
+	uint32_t sequence;
+	do {
+		sequence = lock->sequence;
+		SEQLOCK_BARRIER();
+		memcpy(data, (const uint8_t*)copy + ((sequence & 1) ? size : 0), size);
+		SEQLOCK_BARRIER();
+	} while(sequence != lock->sequence);
+}
+
+#endif
@@ -0,0 +1,197 @@
+#include <stm32f4xx.h>
+#include <stm32f4xx_conf.h>
+#include <drv_uart.h>
+#include <pwm.h>
+#include <rc.h>
+#include <serialrx.h>
+#include <system.h>
+#include <seqlock.h>
+
+/*
+ * @brief ø ű Ʈ ,  ǿ ѹ 
+ */
+const uartDevice_t serialRxUartMap[MAX_RC] = {
+	BOARD_SERIALRX1, BOARD_SERIALRX2,
+};
+
+/*
+ * @brief  Ʈ ġ 
+ */
+static uartDevice_t serialRxUart = 0;
+static const serialRxProtocol_t* serialRxProtocol = NULL;
+
+/*
+ * @brief  Ʈ
+ */
+static uint8_t serialRxBuf[SERIALRX_BUFFER_SIZE];
+static uint8_t serialRxLen = 0;
+
+/*
+ * @brief ڵ 
+ * @note serialRxWork serialRxUpdate ȣϴ ʿ ġ Ӹ   
+ */
+static rcSnapshot_t serialRxWork;
+static rcSnapshot_t serialRxSnapshot[2];
+static seqlock_t serialRxLock;
+static uint32_t serialRxErrorCount = 0;
+
+/*
+ * @brief Է  
+ */
+static serialRxLatency_t serialRxLatency;
+static uint32_t serialRxCharUs = 0; //    ð, Ŭ  us
+static uint32_t serialRxLastPublish = 0;
+
+/*
+ * @brief ø ű ʱȭ
+ * @note  DMA Ƿ Ʈ ͷƮ ɸ 
+ * @param uartDevice: Ʈ ġ ü
+ * @param protocol:  Լ ̺
+ * @retval 
+ */
+void serialRxInit(uartDevice_t uartDevice, const serialRxProtocol_t* protocol) {
+	serialRxUart = uartDevice;
+	serialRxProtocol = protocol;
+
+	//  1Ʈ +  8Ʈ + иƼ + Ʈ
+	const uint8_t bits = 9 + (protocol->parity != USART_Parity_No) + ((protocol->stopBits == USART_StopBits_2) ? 2 : 1);
+	serialRxCharUs = (uint32_t)((uint64_t)1000000 * bits / protocol->baudRate);
+	serialRxLastPublish = cycles();
+
+	uartInitTypeDef_t uartInitStructure;
+	uartStructInit(&uartInitStructure);
+	uartInitStructure.preemptionPriority = 1;
+	uartInitStructure.subPriority = 1;
+	uartInitStructure.baudRate = protocol->baudRate;
+	uartInitStructure.parity = protocol->parity;
+	uartInitStructure.stopBits = protocol->stopBits;
+	uartInitStructure.inverted = protocol->inverted;
+	uartInitStructure.rxDma = true;
+	uartInit(uartDevice, &uartInitStructure);
+}
+
+/*
+ * @brief   Ʈ 
+ * @param count:  Ʈ 
+ * @retval 
+ */
+static void serialRxConsume(uint8_t count) {
+	uint8_t i;
+	for(i = count; i < serialRxLen; i++) {
+		serialRxBuf[i - count] = serialRxBuf[i];
+	}
+	serialRxLen -= count;
+}
+
+/*
+ * @brief ä  , Է  
+ * @note Ʈ idle ð   ̰ ݺ ϶ ̹     
+ * 		  idle  Ʈ    ð ϵǹǷ ׸ŭ 
+ * @param count: ä 
+ * @retval 
+ */
+static void serialRxPublish(uint8_t count) {
+	const uint32_t now = cycles();
+	const uint32_t idle = uartGetIdleTime(serialRxUart);
+	if((int32_t)(idle - serialRxLastPublish) > 0 && (int32_t)(now - idle) >= 0) {
+		const uint32_t us = (uint32_t)cyclesToMicros(now - idle) + serialRxCharUs;
+		serialRxLatency.lastUs = us;
+		serialRxLatency.avgUs = (serialRxLatency.sampleCount == 0) ? us : serialRxLatency.avgUs + ((int32_t)(us - serialRxLatency.avgUs) >> 4);
+		if(us > serialRxLatency.maxUs) {
+			serialRxLatency.maxUs = us;
+		}
+		serialRxLatency.sampleCount++;
+	}
+	serialRxLastPublish = now;
+	serialRxWork.channelCount = count;
+	serialRxWork.timeUs = micros();
+	serialRxWork.frameCount++;
+	seqlockWrite(&serialRxLock, serialRxSnapshot, &serialRxWork, sizeof(rcSnapshot_t));
+}
+
+/*
+ * @brief   ó,   ȣ
+ * @note  Ʋų üũ Ʋ  Ʈ  ٽ ⸦ ã
+ * @param 
+ * @retval 
+ */
+void serialRxUpdate(void) {
+	if(serialRxProtocol == NULL) {
+		return;
+	}
+	while(uartAvailable(serialRxUart)) {
+		serialRxBuf[serialRxLen++] = uartGetChar(serialRxUart);
+		while(serialRxLen > 0) {
+			const uint8_t size = serialRxProtocol->frameSize(serialRxBuf, serialRxLen);
+			if(size == 0 || size > serialRxProtocol->frameSizeMax) {
+				serialRxConsume(1);
+				continue;
+			}
+			if(size > serialRxLen) {
+				break;
+			}
+			if(serialRxProtocol->frameCheck(serialRxBuf, size) == true) {
+				const uint8_t count = serialRxProtocol->frameDecode(serialRxBuf, size, serialRxWork.channel);
+				if(count != 0) {
+					serialRxPublish(count);
+				}
+				serialRxConsume(size);
+			}
+			else {
+				serialRxErrorCount++;
+				serialRxConsume(1);
+			}
+		}
+	}
+}
+
+/*
+ * @brief ű б
+ * @note  RC_CHANNEL_MAX ä RC_MIN ~ RC_MAX ؼ ȯ,     
+ * @param data: 5  ȯ  
+ * @retval 
+ */
+void serialRxRead(uint16_t *data) {
+	serialRxUpdate();
+	rcSnapshot_t snapshot;
+	serialRxGetSnapshot(&snapshot);
+	uint8_t i = 0;
+	for(; i < RC_CHANNEL_MAX && i < snapshot.channelCount; i++) {
+		uint16_t buf = snapshot.channel[i];
+		if(buf < RC_MIN) {
+			buf = RC_MIN;
+		}
+		else if(buf > RC_MAX) {
+			buf = RC_MAX;
+		}
+		data[i] = buf;
+	}
+}
+
+/*
+ * @brief ű  б
+ * @note   us , ͷƮ  ʰ   ü 
+ * @param snapshot:   ü 
+ * @retval 
+ */
+void serialRxGetSnapshot(rcSnapshot_t* snapshot) {
+	seqlockRead(&serialRxLock, serialRxSnapshot, snapshot, sizeof(rcSnapshot_t));
+}
+
+/*
+ * @brief üũ Ʋ  
+ * @param 
+ * @retval  
+ */
+uint32_t serialRxGetErrorCount(void) {
+	return serialRxErrorCount;
+}
+
+/*
+ * @brief Է   б
+ * @param latency: 踦  ü 
+ * @retval 
+ */
+void serialRxGetLatency(serialRxLatency_t* latency) {
+	*latency = serialRxLatency;
+}
@@ -0,0 +1,50 @@
+#ifndef _SERIALRX_H_
+#define _SERIALRX_H_
+
+#include <drv_uart.h>
+#include <rc.h>
+
+#define SERIALRX_BUFFER_SIZE   64 //   Ӻ Ŀ
+#define SERIALRX_CHANNEL_MAX   RC_SNAPSHOT_CHANNEL_MAX
+
+/*
+ * @brief ø ű Ʈ , ű ġ ü ,  board.h
+ */
+extern const uartDevice_t serialRxUartMap[MAX_RC];
+
+/*
+ * @brief ø ű  Լ ̺
+ * @note frameSize: ݱ  Ʈ   Ǵ,  Ʋ 0, ̸ ˷  ޾ƾϸ ʿ Ʈ 
+ * 		  frameCheck:  ̸ŭ   üũ ˻
+ * 		  frameDecode: ä (us) Ǯ ä  ȯ, ä Ͱ  ̸ 0
+ */
+typedef struct {
+	uint32_t baudRate;
+	uint16_t parity;
+	uint16_t stopBits;
+	bool inverted;
+	uint8_t frameSizeMax;
+	uint8_t (*frameSize)(const uint8_t* buf, uint8_t len);
+	bool (*frameCheck)(const uint8_t* frame, uint8_t size);
+	uint8_t (*frameDecode)(const uint8_t* frame, uint8_t size, uint16_t* channel);
+} serialRxProtocol_t;
+
+/*
+ * @brief Է  , ũ 
+ * @note  Ʈ  ð rcRead ä    ְ  ð
+ */
+typedef struct {
+	uint32_t lastUs;
+	uint32_t avgUs;
+	uint32_t maxUs;
+	uint32_t sampleCount;
+} serialRxLatency_t;
+
+void serialRxInit(uartDevice_t uartDevice, const serialRxProtocol_t* protocol);
+void serialRxUpdate(void);
+void serialRxRead(uint16_t *data);
+void serialRxGetSnapshot(rcSnapshot_t* snapshot);
+uint32_t serialRxGetErrorCount(void);
+void serialRxGetLatency(serialRxLatency_t* latency);
+
+#endif
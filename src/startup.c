@@ -0,0 +1,235 @@
+#include <stm32f4xx.h>
+#include <stm32f4xx_conf.h>
+#include <startup.h>
+#include <system.h>
+
+/*
+ * @brief ϵ ܰ
+ */
+static struct {
+	startupFuncPtr_t func;
+	void* context;
+	uint32_t after;    //   ϴ ܰ Ʈũ
+	uint32_t wakeTime; //  ȣ ð(micros)
+	uint8_t phase;
+	startupStat_t stat;
+} startupSteps[STARTUP_STEP_MAX];
+static uint8_t startupStepCount = 0;
+static uint32_t startupEndUs = 0;
+
+/*
+ * @brief ʱȭ ܰ 
+ * @note  ܰ  ϵ ܰ踸   
+ * @param name:   ̸
+ * @param func: ܰ Լ 
+ * @param context: ܰ Լ Ѱ 
+ * @param after:   ϴ ܰ, STARTUP_AFTER(n) | ...,  0
+ * @retval ܰ ȣ(int8_t),  ڸ  -1
+ */
+int8_t startupAddStep(const char* name, startupFuncPtr_t func, void* context, uint32_t after) {
+	if(startupStepCount >= STARTUP_STEP_MAX || (after >> startupStepCount) != 0) {
+		return -1;
+	}
+	const uint8_t i = startupStepCount;
+	startupSteps[i].func = func;
+	startupSteps[i].context = context;
+	startupSteps[i].after = after;
+	startupSteps[i].phase = 0;
+	startupSteps[i].stat.name = name;
+	startupSteps[i].stat.state = STARTUP_STATE_WAIT;
+	startupSteps[i].stat.startUs = 0;
+	startupSteps[i].stat.endUs = 0;
+	startupSteps[i].stat.busyUs = 0;
+	startupSteps[i].stat.callCount = 0;
+	return startupStepCount++;
+}
+
+/*
+ * @brief ϵ ܰ踦   
+ * @note ܰ谡 ٸ   谡  ٸ ܰ踦 ϹǷ  ٸ ġ ʱȭ ħ
+ * 		   ܰ谡   ܰ STARTUP_SLEEP_US ̻  ͷƮ 
+ * 		   ܰ迡 ϴ ܰ ǳʶ, ѽð ȿ   ܰ з 
+ * 		   startupRun  ܰ ٽ  Ƿ, ܰ踦  ϰ ٽ ҷ 
+ * 		  ð  systemInit  ð(micros)
+ * @param timeoutUs: ѽð(us)
+ * @retval  ܰ谡 ϸ SUCCESS
+ */
+ErrorStatus startupRun(uint32_t timeoutUs) {
+	const uint32_t start = micros();
+	uint32_t doneMask = 0, failMask = 0;
+	const uint32_t allMask = (1UL << startupStepCount) - 1; // STARTUP_STEP_MAX < 32
+	uint8_t i;
+
+	for(i = 0; i < startupStepCount; i++) {
+		switch(startupSteps[i].stat.state) {
+		case STARTUP_STATE_DONE:
+			doneMask |= STARTUP_AFTER(i);
+			break;
+		case STARTUP_STATE_FAIL:
+		case STARTUP_STATE_SKIP:
+			failMask |= STARTUP_AFTER(i);
+			break;
+		default:
+			startupSteps[i].wakeTime = start;
+			break;
+		}
+	}
+
+	while((doneMask | failMask) != allMask) {
+		uint32_t now = micros();
+		int32_t minWait = STARTUP_SLEEP_US + 1;
+		bool ran = false;
+
+		if(now - start >= timeoutUs) {
+			for(i = 0; i < startupStepCount; i++) {
+				if(((doneMask | failMask) & STARTUP_AFTER(i)) == 0) {
+					startupSteps[i].stat.state = STARTUP_STATE_FAIL;
+					startupSteps[i].stat.endUs = now;
+				}
+			}
+			failMask = allMask & ~doneMask;
+			break;
+		}
+
+		for(i = 0; i < startupStepCount; i++) {
+			startupStat_t* stat = &startupSteps[i].stat;
+			const uint32_t bit = STARTUP_AFTER(i);
+			if((doneMask | failMask) & bit) {
+				continue;
+			}
+			if(startupSteps[i].after & failMask) {
+				stat->state = STARTUP_STATE_SKIP;
+				stat->endUs = now;
+				failMask |= bit;
+				continue;
+			}
+			if((startupSteps[i].after & ~doneMask) != 0) {
+				continue;
+			}
+			const int32_t wait = (int32_t)(startupSteps[i].wakeTime - now);
+			if(wait > 0) {
+				if(wait < minWait) {
+					minWait = wait;
+				}
+				continue;
+			}
+
+			if(stat->state == STARTUP_STATE_WAIT) {
+				stat->state = STARTUP_STATE_RUN;
+				stat->startUs = now;
+			}
+			const int32_t result = startupSteps[i].func(startupSteps[i].context, &startupSteps[i].phase);
+			const uint32_t end = micros();
+			stat->busyUs += end - now;
+			stat->callCount++;
+			if(result == STARTUP_DONE) {
+				stat->state = STARTUP_STATE_DONE;
+				stat->endUs = end;
+				doneMask |= bit;
+			}
+			else if(result < 0) {
+				stat->state = STARTUP_STATE_FAIL;
+				stat->endUs = end;
+				failMask |= bit;
+			}
+			else {
+				startupSteps[i].wakeTime = end + result;
+			}
+			now = end;
+			ran = true;
+		}
+
+		if(ran == false && minWait > STARTUP_SLEEP_US) {
+			__WFI();
+		}
+	}
+
+	startupEndUs = micros();
+	return (failMask == 0) ? SUCCESS : ERROR;
+}
+
+/*
+ * @brief ܰ躰 ð  б
+ * @param step: ܰ ȣ
+ * @param stat:   ü 
+ * @retval 
+ */
+void startupGetStat(uint8_t step, startupStat_t* stat) {
+	*stat = startupSteps[step].stat;
+}
+
+/*
+ * @brief  ð,  startupRun  ð
+ * @param 
+ * @retval systemInit  ũ(uint32_t)
+ */
+uint32_t startupGetTotalTime(void) {
+	return startupEndUs;
+}
+
+/*
+ * @brief 10 ڿ ۿ 
+ * @param buf:  
+ * @param value: 
+ * @retval   ġ
+ */
+static char* startupPutNumber(char* buf, uint32_t value) {
+	char digits[10];
+	uint8_t n = 0;
+	do {
+		digits[n++] = '0' + value % 10;
+		value /= 10;
+	} while(value != 0);
+	while(n != 0) {
+		*buf++ = digits[--n];
+	}
+	return buf;
+}
+
+/*
+ * @brief ڿ ۿ 
+ * @param buf:  
+ * @param str: ڿ
+ * @param max: ִ  
+ * @retval   ġ
+ */
+static char* startupPutString(char* buf, const char* str, uint8_t max) {
+	while(*str != '\0' && max--) {
+		*buf++ = *str++;
+	}
+	return buf;
+}
+
+/*
+ * @brief ܰ躰 ð  ø 
+ * @note  ٿ  ܰ: ̸ start end busy ,  us,   ü ð
+ * @param 
+ * @retval 
+ */
+void startupReport(void) {
+	static const char* const stateName[] = { "wait", "run", "ok", "fail", "skip" };
+	char line[96];
+	uint8_t i;
+
+	for(i = 0; i < startupStepCount; i++) {
+		const startupStat_t* stat = &startupSteps[i].stat;
+		char* p = line;
+		p = startupPutString(p, "boot ", STARTUP_NAME_MAX);
+		p = startupPutString(p, stat->name, STARTUP_NAME_MAX);
+		p = startupPutString(p, " start ", STARTUP_NAME_MAX);
+		p = startupPutNumber(p, stat->startUs);
+		p = startupPutString(p, " end ", STARTUP_NAME_MAX);
+		p = startupPutNumber(p, stat->endUs);
+		p = startupPutString(p, " busy ", STARTUP_NAME_MAX);
+		p = startupPutNumber(p, stat->busyUs);
+		*p++ = ' ';
+		p = startupPutString(p, stateName[stat->state], STARTUP_NAME_MAX);
+		*p++ = '\n';
+		serialWrite((const uint8_t*)line, p - line);
+	}
+	char* p = line;
+	p = startupPutString(p, "boot total ", STARTUP_NAME_MAX);
+	p = startupPutNumber(p, startupEndUs);
+	*p++ = '\n';
+	serialWrite((const uint8_t*)line, p - line);
+}
@@ -0,0 +1,76 @@
+#ifndef _STARTUP_H_
+#define _STARTUP_H_
+
+#include <stm32f4xx.h>
+
+/*
+ * @brief  谡 ִ ʱȭ ܰ踦 ļ 
+ * @note  :
+ * 		    systemInitAsync();
+ * 		    startupAddStep("mpu6050", mpu6050InitStep, &imuI2c, STARTUP_AFTER(SYSTEM_STEP_CONFIG));
+ * 		    startupRun(STARTUP_TIMEOUT_US);
+ * 		    startupReport();
+ */
+
+#ifndef bool
+typedef uint8_t bool;
+#define false (bool) 0
+#define true (bool) 1
+#define NULL ((void *)0)
+#endif
+
+#define STARTUP_STEP_MAX     16
+#define STARTUP_SLEEP_US     1000    //  ܰ ̺   WFI, SysTick(1ms) 
+#define STARTUP_TIMEOUT_US   1000000 // startupRun ⺻ ѽð
+#define STARTUP_NAME_MAX     16      //   ̸ 
+
+/*
+ * @brief ܰ Լ ȯ,  ٽ ȣҶ ٸ ð(us)
+ */
+#define STARTUP_DONE   0
+#define STARTUP_FAIL   (-1)
+
+/*
+ * @brief  ܰ Ʈũ
+ */
+#define STARTUP_AFTER(step) (1UL << (step))
+
+/*
+ * @brief ʱȭ ܰ Լ
+ * @note ٷ ϴ  phase   ٲٰ ٸ ð ȯ,  phase ٽ ҷ 
+ * 		  phase ó 0, : Ҷ ѱ context, ܰ躰 phase 
+ */
+typedef int32_t (*startupFuncPtr_t) (void*, uint8_t*);
+
+/*
+ * @brief ܰ  ü
+ */
+typedef enum {
+	STARTUP_STATE_WAIT = 0, //  ܰ踦 ٸ 
+	STARTUP_STATE_RUN,
+	STARTUP_STATE_DONE,
+	STARTUP_STATE_FAIL,
+	STARTUP_STATE_SKIP,     //  ܰ谡 ؼ  
+} startupState_t;
+
+/*
+ * @brief ܰ躰 ð , ũ 
+ * @note ð systemInit  ð, busyUs ܰ Լ ȿ  ð
+ * 		  end - start busyUs   ٸ  ٸ ܰ谡 
+ */
+typedef struct {
+	const char* name;
+	startupState_t state;
+	uint32_t startUs; // ó ȣ ð
+	uint32_t endUs;   //  ð
+	uint32_t busyUs;
+	uint16_t callCount;
+} startupStat_t;
+
+int8_t startupAddStep(const char* name, startupFuncPtr_t func, void* context, uint32_t after);
+ErrorStatus startupRun(uint32_t timeoutUs);
+void startupGetStat(uint8_t step, startupStat_t* stat);
+uint32_t startupGetTotalTime(void);
+void startupReport(void);
+
+#endif
@@ -1,10 +1,16 @@
 #include <stm32f4xx.h>
 #include <stm32f4xx_conf.h>
 #include <drv_uart.h>
+#include <system.h>
+#include <profiler.h>
+#include <ccm.h>
+#include <config.h>
+#include <startup.h>
+#include <clock.h>
 
 static void serialInit(uartDevice_t uartDevice_);
-void setSystemClock(uint32_t clocks);
-uint32_t getSystemClock(void);
+static int32_t systemSerialStep(void* context, uint8_t* phase);
+static int32_t systemConfigStep(void* context, uint8_t* phase);
 
 /*
  * @brief ý Ŭ  
@@ -18,9 +24,26 @@ static uint32_t systemClocks = 0;
 static volatile uint32_t sysTickNum;
 
 /*
- * @brief  ܺͷƮ ġ  
+ * @brief 64Ʈ Ȯ Ŭ ī ذ,  
+ * @note SysTick ڵ鷯 cycleBase[cycleBaseIndex ^ 1]  ε 
+ * 		  д  ڵ鷯 켱 Ƶ   ۸  
  */
-static uint32_t usTicks;
+static volatile uint64_t cycleBase[2];
+static volatile uint8_t cycleBaseIndex = 0;
+
+/*
+ * @brief Ŭ -> ũ ȯ , us = cycles * usMult >> usShift
+ * @note usMult 2^31 ~ 2^32  鵵 usShift ؼ   ȯ
+ */
+static uint32_t usMult;
+static uint8_t usShift;
+
+/*
+ * @brief  Ŭ ٲ ð, micros64 = microsBase + (cycles64 - microsCycleBase) ȯ
+ * @note Ŭ ٲ micros()  ʵ ٲܶ ű
+ */
+static uint64_t microsBase = 0;
+static uint64_t microsCycleBase = 0;
 
 /*
  * @brief  ܺͷƮ ġ  
@@ -29,21 +52,63 @@ static uartDevice_t uartDevice = 0;
 
 /*
  * @brief ý ʱȭ
+ * @note ϵ ʱȭ ܰ踦   ƿ
  * @param 
  * @retval 
  */
 void systemInit(void) {
+	systemInitAsync();
+	startupRun(STARTUP_TIMEOUT_US);
+}
+
+/*
+ * @brief ý ʱȭ, ġ ʱȭ ܰ ϸ 
+ * @note Ŭ ð Լ ٷ ϰ, ø  Ҵ SYSTEM_STEP_xxx ܰ 
+ * 		  ٸ ġ ܰ踦    startupRun θ  ļ ʱȭ
+ * @param 
+ * @retval 
+ */
+void systemInitAsync(void) {
+	ccmInit(); // CCM  ٸ ʱȭ  ä
 	SystemInit();
-	RCC_ClocksTypeDef rcc_clocks;
-	RCC_GetClocksFreq(&rcc_clocks);
-	uint32_t systemClocks_ = rcc_clocks.SYSCLK_Frequency;
-	setSystemClock(systemClocks_);
-	//72000000 / 1000000 = 72
-	usTicks = systemClocks_ / 1000000;
-	//72000000 / 1000 = 72000, sysTick init
-	SysTick_Config(systemClocks_ / 1000);
 
+	// DWT Ŭ ī Ȱȭ
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+	cycleBase[0] = 0;
+	cycleBaseIndex = 0;
+
+	//  Ŭ  , HSE  SystemInit  Ŭ ״
+	if(clockSetProfile(BOARD_CLOCK_PROFILE) == ERROR) {
+		RCC_ClocksTypeDef rcc_clocks;
+		RCC_GetClocksFreq(&rcc_clocks);
+		setSystemClock(rcc_clocks.HCLK_Frequency);
+	}
+
+	//   SYSTEM_STEP_xxx ȣ
+	startupAddStep("serial", systemSerialStep, NULL, 0);
+	startupAddStep("config", systemConfigStep, NULL, 0);
+}
+
+/*
+ * @brief ø ʱȭ ܰ
+ */
+static int32_t systemSerialStep(void* context, uint8_t* phase) {
+	(void)context;
+	(void)phase;
 	serialInit(UART_DEVICE_6);
+	return STARTUP_DONE;
+}
+
+/*
+ * @brief   ʱȭ ܰ
+ * @note ϸ   ÷ÿ ٷ ,    ܰ  ܰ ڿ Ѱ
+ */
+static int32_t systemConfigStep(void* context, uint8_t* phase) {
+	(void)context;
+	(void)phase;
+	return (configInit(&configFlashInternal) == SUCCESS) ? STARTUP_DONE : STARTUP_FAIL;
 }
 
 /*
@@ -54,6 +119,7 @@ void systemInit(void) {
 static void serialInit(uartDevice_t uartDevice_) {
 	uartDevice = uartDevice_;
 	uartInitTypeDef_t uartInitStructure;
+	uartStructInit(&uartInitStructure);
 	uartInitStructure.preemptionPriority = 0;
 	uartInitStructure.subPriority = 1;
 	uartInitStructure.baudRate = 115200;
@@ -69,6 +135,25 @@ void serialPutChar(uint8_t c) {
 	uartPutChar(uartDevice, c);
 }
 
+/*
+ * @brief ø ̳ʸ 
+ * @param data:   
+ * @param len:  Ʈ 
+ * @retval 
+ */
+void serialWrite(const uint8_t* data, uint16_t len) {
+	uartWrite(uartDevice, data, len);
+}
+
+/*
+ * @brief ø  ۿ  Ʈ 
+ * @param 
+ * @retval Ʈ (uint16_t)
+ */
+uint16_t serialAvailable(void) {
+	return uartAvailable(uartDevice);
+}
+
 /*
  * @brief ø  б
  * @param 
@@ -80,11 +165,30 @@ uint8_t serialGetChar(void) {
 
 /*
  * @brief ý Ŭ 
- * @param clocks:  Ŭ
+ * @note ھ Ŭ ٲ Ŀ θ(clock.c), ð  ű SysTick 1ms ٽ 
+ * 		  ٲ  Ŭ  Ŭ   ȯϹǷ micros() ̾
+ * @param clocks:  Ŭ(HCLK)
  * @retval 
  */
 void setSystemClock(uint32_t clocks) {
+	const uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	if(systemClocks != 0) {
+		const uint64_t now = cycles64();
+		microsBase += cyclesToMicros(now - microsCycleBase);
+		microsCycleBase = now;
+	}
 	systemClocks = clocks;
+
+	// 2^usShift * 10^6 / clocks  2^31 ̻ Ǵ ּ usShift
+	usShift = 32;
+	while((((uint64_t)1000000 << usShift) / clocks) < 0x80000000UL) {
+		usShift++;
+	}
+	usMult = ((uint64_t)1000000 << usShift) / clocks;
+
+	SysTick_Config(clocks / 1000);
+	__set_PRIMASK(primask);
 }
 
 /*
@@ -96,22 +200,54 @@ uint32_t getSystemClock(void) {
 	return systemClocks;
 }
 
+/*
+ * @brief 64Ʈ Ŭ īƮ б
+ * @note DWT->CYCCNT 168Mhz  25ʸ ġǷ SysTick ذ ؼ Ȯ
+ * @param 
+ * @retval ý ʱȭ  Ŭ (uint64_t)
+ */
+uint64_t cycles64(void) {
+	uint32_t tick, now;
+	uint64_t base;
+	do {
+		tick = sysTickNum;
+		base = cycleBase[cycleBaseIndex];
+		now = DWT->CYCCNT; // ذ ߿ о ̰   
+	} while(tick != sysTickNum); // д  ذ ι ̻ ŵ
+	return base + (uint32_t)(now - (uint32_t)base);
+}
+
+/*
+ * @brief Ŭ  ũʷ ȯ
+ * @note  Ʈ , UMULL ι
+ * @param cycles: Ŭ 
+ * @retval ũ(uint64_t)
+ */
+uint64_t cyclesToMicros(uint64_t cycles) {
+	const uint32_t hi = cycles >> 32;
+	const uint32_t lo = (uint32_t)cycles;
+	return ((uint64_t)hi * usMult + (((uint64_t)lo * usMult) >> 32)) >> (usShift - 32);
+}
+
+/*
+ * @brief  ũ б, 64Ʈ
+ * @param 
+ * @retval ý ʱȭ  ũ(uint64_t)
+ */
+uint64_t micros64(void) {
+	return microsBase + cyclesToMicros(cycles64() - microsCycleBase);
+}
+
 /*
  * @brief  ũ б
  * @note !, uint32_t  Ÿ  ϹǷ 70  0 ư
+ * 		   ð ̴ ȣ  ϸ ħ  ,  ð micros64 
  * @param 
  * @retval ý ʱȭ  ũ(uint32_t)
  */
 uint32_t micros(void)
 {
-    register uint32_t ms, cycle_cnt;
-    do {
-        ms = sysTickNum;
-        cycle_cnt = SysTick->VAL;
-    } while (ms != sysTickNum); // SysTick->VAL ȿҶ
-    // иʴ ũ 10^3̹Ƿ *1000
-    // ý  tick val ߴ ֺ  Ʈ ǰ, ⺻ Ŭ 72Mhz̰  1Mhz Ƿ / 72
-    return (ms * 1000) + ((usTicks * 1000 - cycle_cnt) / usTicks);
+	return (uint32_t)micros64();
 }
 
 /*
@@ -150,6 +286,81 @@ void delay(uint32_t ms)
     }
 }
 
+/*
+ * @brief  SysTick  micros, timeBenchmark 񱳿
+ * @param usTicks: ũʴ Ŭ
+ * @retval ũ(uint32_t)
+ */
+static uint32_t microsSysTick(uint32_t usTicks) {
+	uint32_t ms, cycle_cnt;
+	do {
+		ms = sysTickNum;
+		cycle_cnt = SysTick->VAL;
+	} while(ms != sysTickNum);
+	return (ms * 1000) + ((usTicks * 1000 - cycle_cnt) / usTicks);
+}
+
+/*
+ * @brief ð Լ ȣ  
+ * @note ߿ ͷƮ Ƿ  ĳ ܿθ ȣ
+ * 		   volatile  ؼ ȣ ȭ  ʰ ϰ,   Ŭ 
+ * @param result:   ü 
+ * @retval 
+ */
+void timeBenchmark(timeBenchmark_t* result) {
+	const uint32_t usTicks = systemClocks / 1000000;
+	volatile uint32_t sink = 0;
+	uint32_t i, start, loop;
+	const uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	start = cycles();
+	for(i = 0; i < TIME_BENCHMARK_COUNT; i++) {
+		sink += i;
+	}
+	loop = cycles() - start;
+
+	start = cycles();
+	for(i = 0; i < TIME_BENCHMARK_COUNT; i++) {
+		sink += cycles();
+	}
+	result->cyclesCycles = (cycles() - start - loop) / TIME_BENCHMARK_COUNT;
+
+	start = cycles();
+	for(i = 0; i < TIME_BENCHMARK_COUNT; i++) {
+		sink += (uint32_t)cycles64();
+	}
+	result->cycles64Cycles = (cycles() - start - loop) / TIME_BENCHMARK_COUNT;
+
+	start = cycles();
+	for(i = 0; i < TIME_BENCHMARK_COUNT; i++) {
+		sink += micros();
+	}
+	result->microsCycles = (cycles() - start - loop) / TIME_BENCHMARK_COUNT;
+
+	start = cycles();
+	for(i = 0; i < TIME_BENCHMARK_COUNT; i++) {
+		sink += (uint32_t)micros64();
+	}
+	result->micros64Cycles = (cycles() - start - loop) / TIME_BENCHMARK_COUNT;
+
+	start = cycles();
+	for(i = 0; i < TIME_BENCHMARK_COUNT; i++) {
+		sink += microsSysTick(usTicks);
+	}
+	result->sysTickCycles = (cycles() - start - loop) / TIME_BENCHMARK_COUNT;
+
+	__set_PRIMASK(primask);
+}
+
 void SysTick_Handler() {
+	PROFILE_ENTER();
+	//  ʴ  ۿ  ذ  ε 
+	const uint8_t next = cycleBaseIndex ^ 1;
+	const uint64_t base = cycleBase[cycleBaseIndex];
+	const uint32_t now = DWT->CYCCNT;
+	cycleBase[next] = base + (uint32_t)(now - (uint32_t)base);
+	cycleBaseIndex = next;
 	sysTickNum++;
+	PROFILE_EXIT(PROF_SYSTICK);
 }
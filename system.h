@@ -2,27 +2,71 @@
 #define _SYSTEM_H_
 
 #include <stm32f4xx.h>
+#include <drv_gpio.h>
+#include <fastmath.h>
 
 #define RAD_TO_DEG 57.295779513082320876798154814105
 
-#define abs(x) ((x)>0?(x):-(x))
+/*
+ * @brief 밪, μ ѹ (fastmath.h absf, absd, absi)
+ * @note  int32_t , C++ std::abs 
+ */
+#ifndef __cplusplus
+#define abs(x) __builtin_choose_expr(__builtin_types_compatible_p(__typeof__(x), float), absf(x), \
+	__builtin_choose_expr(__builtin_types_compatible_p(__typeof__(x), double), absd(x), absi(x)))
+#endif
 #define constrain(amt,low,high) ((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
 #define degrees(rad) ((rad)*RAD_TO_DEG)
 
-#define digitalHi(p, i)     { p->BSRR = i; }
-#define digitalLo(p, i)     { p->BRR = i; }
-#define digitalToggle(p, i) { p->ODR ^= i; }
-#define digitalIn(p, i)     (p->IDR & i)
+#define digitalHi(p, i)     gpioSet(p, i)
+#define digitalLo(p, i)     gpioClear(p, i)
+#define digitalToggle(p, i) gpioToggle(p, i)
+#define digitalIn(p, i)     gpioRead(p, i)
+
+/*
+ * @brief systemInitAsync ϴ ʱȭ ܰ ȣ, STARTUP_AFTER() 
+ */
+#define SYSTEM_STEP_SERIAL 0
+#define SYSTEM_STEP_CONFIG 1
+
+#define TIME_BENCHMARK_COUNT 1000 // Լ ȣ Ƚ
+
+/*
+ * @brief ð Լ  , ȣ ѹ Ŭ(  )
+ */
+typedef struct {
+	uint32_t cyclesCycles;   // cycles()
+	uint32_t cycles64Cycles; // cycles64()
+	uint32_t microsCycles;   // micros()
+	uint32_t micros64Cycles; // micros64()
+	uint32_t sysTickCycles;  //   SysTick->VAL  ι, 񱳿
+} timeBenchmark_t;
 
 void systemInit(void);
+void systemInitAsync(void);
+void setSystemClock(uint32_t clocks);
 uint32_t getSystemClock(void);
 
 void serialPutChar(uint8_t c);
 uint8_t serialGetChar(void);
+void serialWrite(const uint8_t* data, uint16_t len);
+uint16_t serialAvailable(void);
+
+/*
+ * @brief  Ŭ īƮ б, ϸ
+ * @note 168Mhz  25ʸ ħ,   ȣ 
+ */
+static inline uint32_t cycles(void) {
+	return DWT->CYCCNT;
+}
 
+uint64_t cycles64(void);
+uint64_t cyclesToMicros(uint64_t cycles);
+uint64_t micros64(void);
 uint32_t micros(void);
 uint32_t millis(void);
 void delayMicroseconds(uint32_t us);
 void delay(uint32_t ms);
+void timeBenchmark(timeBenchmark_t* result);
 
 #endif
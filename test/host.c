@@ -0,0 +1,7 @@
+#include <stm32f4xx.h>
+
+/*
+ * @brief   DWT,  CYCCNT   ð 䳻
+ */
+DWT_Type hostDwt;
+CoreDebug_Type hostCoreDebug;
@@ -0,0 +1,173 @@
+/*
+ * ȣƮ  CMSIS ġ  ּ 뿪
+ *  ü  ġ , ֺġ ּҴ ϸ  
+ * DWT  Ŭ ī͸   ֵ  (hostDwt, host.c) 
+ */
+#ifndef __STM32F4xx_H
+#define __STM32F4xx_H
+#include <stdint.h>
+#define __IO volatile
+#define __I volatile const
+#define __O volatile
+#define __INLINE inline
+#define __STATIC_INLINE static inline
+#define __ASM __asm
+typedef enum {RESET = 0, SET = !RESET} FlagStatus, ITStatus;
+typedef enum {DISABLE = 0, ENABLE = !DISABLE} FunctionalState;
+typedef enum {ERROR = 0, SUCCESS = !ERROR} ErrorStatus;
+typedef enum { NonMaskableInt_IRQn=-14, SysTick_IRQn=-1, EXTI0_IRQn=6, EXTI1_IRQn, EXTI2_IRQn, EXTI3_IRQn, EXTI4_IRQn,
+ DMA1_Stream0_IRQn=11, DMA1_Stream1_IRQn, DMA1_Stream2_IRQn, DMA1_Stream3_IRQn, DMA1_Stream4_IRQn, DMA1_Stream5_IRQn, DMA1_Stream6_IRQn,
+ EXTI9_5_IRQn=23, TIM1_BRK_TIM9_IRQn=24, TIM1_UP_TIM10_IRQn=25, TIM1_TRG_COM_TIM11_IRQn=26, TIM1_CC_IRQn=27, TIM2_IRQn=28, TIM3_IRQn=29, TIM4_IRQn=30,
+ I2C1_EV_IRQn=31, I2C1_ER_IRQn, I2C2_EV_IRQn, I2C2_ER_IRQn, USART1_IRQn=37, USART2_IRQn, USART3_IRQn, EXTI15_10_IRQn=40,
+ TIM8_BRK_TIM12_IRQn=43, TIM8_UP_TIM13_IRQn, TIM8_TRG_COM_TIM14_IRQn, TIM8_CC_IRQn, DMA1_Stream7_IRQn=47, TIM5_IRQn=50, UART4_IRQn=52, UART5_IRQn=53,
+ TIM6_DAC_IRQn=54, TIM7_IRQn=55, DMA2_Stream0_IRQn=56, DMA2_Stream1_IRQn, DMA2_Stream2_IRQn, DMA2_Stream3_IRQn, DMA2_Stream4_IRQn,
+ DMA2_Stream5_IRQn=68, DMA2_Stream6_IRQn, DMA2_Stream7_IRQn, USART6_IRQn=71, FPU_IRQn=81 } IRQn_Type;
+typedef struct { __IO uint32_t MODER, OTYPER, OSPEEDR, PUPDR, IDR, ODR; __IO uint16_t BSRRL, BSRRH; __IO uint32_t LCKR; __IO uint32_t AFR[2]; } GPIO_TypeDef;
+typedef struct { __IO uint16_t SR, r0, DR, r1, BRR, r2, CR1, r3, CR2, r4, CR3, r5, GTPR, r6; } USART_TypeDef;
+typedef struct { __IO uint16_t CR1, r0, CR2, r1, OAR1, r2, OAR2, r3, DR, r4, SR1, r5, SR2, r6, CCR, r7, TRISE, r8; } I2C_TypeDef;
+typedef struct { __IO uint32_t IMR, EMR, RTSR, FTSR, SWIER, PR; } EXTI_TypeDef;
+typedef struct { __IO uint16_t CR1, r0, CR2, r1, SMCR, r2, DIER, r3, SR, r4, EGR, r5, CCMR1, r6, CCMR2, r7, CCER, r8; __IO uint32_t CNT; __IO uint16_t PSC, r9; __IO uint32_t ARR; __IO uint16_t RCR, r10; __IO uint32_t CCR1, CCR2, CCR3, CCR4; __IO uint16_t BDTR, r11, DCR, r12, DMAR, r13, OR, r14; } TIM_TypeDef;
+typedef struct { __IO uint32_t CR, NDTR, PAR, M0AR, M1AR, FCR; } DMA_Stream_TypeDef;
+typedef struct { __IO uint32_t LISR, HISR, LIFCR, HIFCR; } DMA_TypeDef;
+typedef struct { __IO uint32_t ACR, KEYR, OPTKEYR, SR, CR, OPTCR; } FLASH_TypeDef;
+typedef struct { __IO uint32_t CR, PLLCFGR, CFGR, CIR, AHB1RSTR, AHB2RSTR, AHB3RSTR, r0, APB1RSTR, APB2RSTR, r1[2], AHB1ENR, AHB2ENR, AHB3ENR, r2, APB1ENR, APB2ENR; } RCC_TypeDef;
+typedef struct { __IO uint32_t CTRL, LOAD, VAL; __I uint32_t CALIB; } SysTick_Type;
+typedef struct { __IO uint32_t CTRL, CYCCNT, CPICNT, EXCCNT, SLEEPCNT, LSUCNT, FOLDCNT; __I uint32_t PCSR; } DWT_Type;
+typedef struct { __IO uint32_t DHCSR, DCRSR, DCRDR, DEMCR; } CoreDebug_Type;
+typedef struct { __I uint32_t CPUID; __IO uint32_t ICSR, VTOR, AIRCR, SCR, CCR; __IO uint8_t SHP[12]; __IO uint32_t SHCSR, CFSR, HFSR, DFSR, MMFAR, BFAR, AFSR; __I uint32_t PFR[2], DFR, ADR, MMFR[4], ISAR[5]; uint32_t r0[5]; __IO uint32_t CPACR; } SCB_Type;
+typedef struct { __IO uint32_t ISER[8]; uint32_t r0[24]; __IO uint32_t ICER[8]; uint32_t r1[24]; __IO uint32_t ISPR[8]; uint32_t r2[24]; __IO uint32_t ICPR[8]; uint32_t r3[24]; __IO uint32_t IABR[8]; uint32_t r4[56]; __IO uint8_t IP[240]; } NVIC_Type;
+#define GPIOA ((GPIO_TypeDef *)0x40020000UL)
+#define GPIOB ((GPIO_TypeDef *)0x40020400UL)
+#define GPIOC ((GPIO_TypeDef *)0x40020800UL)
+#define GPIOD ((GPIO_TypeDef *)0x40020C00UL)
+#define USART1 ((USART_TypeDef *)0x40011000UL)
+#define USART2 ((USART_TypeDef *)0x40004400UL)
+#define USART3 ((USART_TypeDef *)0x40004800UL)
+#define UART4 ((USART_TypeDef *)0x40004C00UL)
+#define UART5 ((USART_TypeDef *)0x40005000UL)
+#define USART6 ((USART_TypeDef *)0x40011400UL)
+#define I2C1 ((I2C_TypeDef *)0x40005400UL)
+#define I2C2 ((I2C_TypeDef *)0x40005800UL)
+#define EXTI ((EXTI_TypeDef *)0x40013C00UL)
+#define TIM1 ((TIM_TypeDef *)0x40010000UL)
+#define TIM2 ((TIM_TypeDef *)0x40000000UL)
+#define TIM3 ((TIM_TypeDef *)0x40000400UL)
+#define TIM4 ((TIM_TypeDef *)0x40000800UL)
+#define TIM5 ((TIM_TypeDef *)0x40000C00UL)
+#define TIM7 ((TIM_TypeDef *)0x40001400UL)
+#define TIM8 ((TIM_TypeDef *)0x40010400UL)
+#define TIM9 ((TIM_TypeDef *)0x40014000UL)
+#define TIM12 ((TIM_TypeDef *)0x40001800UL)
+#define TIM10 ((TIM_TypeDef *)0x40014400UL)
+#define TIM11 ((TIM_TypeDef *)0x40014800UL)
+#define DMA1 ((DMA_TypeDef *)0x40026000UL)
+#define DMA2 ((DMA_TypeDef *)0x40026400UL)
+#define FLASH ((FLASH_TypeDef *)0x40023C00UL)
+#define RCC ((RCC_TypeDef *)0x40023800UL)
+#define SysTick ((SysTick_Type *)0xE000E010UL)
+extern DWT_Type hostDwt;
+#define DWT (&hostDwt)
+extern CoreDebug_Type hostCoreDebug;
+#define CoreDebug (&hostCoreDebug)
+#define SCB ((SCB_Type *)0xE000ED00UL)
+#define NVIC ((NVIC_Type *)0xE000E100UL)
+#define DMA1_Stream0 ((DMA_Stream_TypeDef *)0x40026010UL)
+#define DMA1_Stream1 ((DMA_Stream_TypeDef *)0x40026028UL)
+#define DMA1_Stream2 ((DMA_Stream_TypeDef *)0x40026040UL)
+#define DMA1_Stream3 ((DMA_Stream_TypeDef *)0x40026058UL)
+#define DMA1_Stream4 ((DMA_Stream_TypeDef *)0x40026070UL)
+#define DMA1_Stream5 ((DMA_Stream_TypeDef *)0x40026088UL)
+#define DMA1_Stream6 ((DMA_Stream_TypeDef *)0x400260A0UL)
+#define DMA1_Stream7 ((DMA_Stream_TypeDef *)0x400260B8UL)
+#define DMA2_Stream0 ((DMA_Stream_TypeDef *)0x40026410UL)
+#define DMA2_Stream1 ((DMA_Stream_TypeDef *)0x40026428UL)
+#define DMA2_Stream2 ((DMA_Stream_TypeDef *)0x40026440UL)
+#define DMA2_Stream3 ((DMA_Stream_TypeDef *)0x40026458UL)
+#define DMA2_Stream4 ((DMA_Stream_TypeDef *)0x40026470UL)
+#define DMA2_Stream5 ((DMA_Stream_TypeDef *)0x40026488UL)
+#define DMA2_Stream6 ((DMA_Stream_TypeDef *)0x400264A0UL)
+#define DMA2_Stream7 ((DMA_Stream_TypeDef *)0x400264B8UL)
+#define PERIPH_BASE 0x40000000UL
+#define PERIPH_BB_BASE 0x42000000UL
+#define SRAM1_BASE 0x20000000UL
+#define SRAM_BB_BASE 0x22000000UL
+#define CCMDATARAM_BASE 0x10000000UL
+#define GPIOA_BASE 0x40020000UL
+#define FLASH_BASE 0x08000000UL
+#define CoreDebug_DEMCR_TRCENA_Msk (1UL << 24)
+#define DWT_CTRL_CYCCNTENA_Msk (1UL)
+#define SysTick_CTRL_ENABLE_Msk 1UL
+#define SysTick_CTRL_TICKINT_Msk 2UL
+#define SysTick_CTRL_CLKSOURCE_Msk 4UL
+#define SysTick_LOAD_RELOAD_Msk 0xFFFFFFUL
+#define SCB_SCR_SLEEPONEXIT_Msk 2UL
+#define SCB_SCR_SLEEPDEEP_Msk 4UL
+#define SCB_ICSR_PENDSTSET_Msk (1UL<<26)
+#define DMA_SxCR_EN 1UL
+#define DMA_SxCR_TCIE (1UL<<4)
+#define DMA_SxCR_CHSEL (7UL<<25)
+#define TIM_DIER_UDE (1<<8)
+#define TIM_CR1_CEN 1
+#define TIM_EGR_UG 1
+#define TIM_CCER_CC1E 1
+#define TIM_CCER_CC1P 2
+#define TIM_CCER_CC1NP 8
+#define TIM_SR_CC1IF 2
+#define TIM_SR_CC1OF (1<<9)
+#define TIM_SR_UIF 1
+#define USART_CR1_UE (1<<13)
+#define USART_SR_RXNE (1<<5)
+#define USART_SR_IDLE (1<<4)
+#define USART_CR3_DMAR (1<<6)
+#define USART_CR3_DMAT (1<<7)
+#define FLASH_ACR_LATENCY 7UL
+#define FLASH_ACR_PRFTEN (1UL<<8)
+#define FLASH_ACR_ICEN (1UL<<9)
+#define FLASH_ACR_DCEN (1UL<<10)
+#define RCC_CR_HSEON (1UL<<16)
+#define RCC_CR_HSERDY (1UL<<17)
+#define RCC_CR_HSION 1UL
+#define RCC_CR_HSIRDY 2UL
+#define RCC_CR_PLLON (1UL<<24)
+#define RCC_CR_PLLRDY (1UL<<25)
+#define RCC_CFGR_SW 3UL
+#define RCC_CFGR_SW_HSI 0UL
+#define RCC_CFGR_SW_HSE 1UL
+#define RCC_CFGR_SW_PLL 2UL
+#define RCC_CFGR_SWS 0xCUL
+#define RCC_CFGR_SWS_PLL 8UL
+#define RCC_CFGR_SWS_HSI 0UL
+#define RCC_CFGR_HPRE 0xF0UL
+#define RCC_CFGR_PPRE1 0x1C00UL
+#define RCC_CFGR_PPRE2 0xE000UL
+#define RCC_PLLCFGR_PLLSRC_HSE (1UL<<22)
+#define PWR_CR_VOS (1UL<<14)
+static inline void __DMB(void) {}
+static inline void __DSB(void) {}
+static inline void __ISB(void) {}
+static inline void __WFI(void) {}
+static inline void __NOP(void) {}
+static inline void __enable_irq(void) {}
+static inline void __disable_irq(void) {}
+static inline uint32_t __get_PRIMASK(void) { return 0; }
+static inline void __set_PRIMASK(uint32_t p) { (void)p; }
+static inline uint32_t __get_IPSR(void) { return 0; }
+static inline uint32_t __get_MSP(void) { return 0; }
+static inline void __set_MSP(uint32_t p) { (void)p; }
+static inline uint32_t __CLZ(uint32_t v) { return v ? __builtin_clz(v) : 32; }
+static inline uint32_t __RBIT(uint32_t v) { return v; }
+static inline uint32_t __REV(uint32_t v) { return __builtin_bswap32(v); }
+static inline uint32_t __LDREXW(volatile uint32_t* a) { return *a; }
+static inline uint32_t __STREXW(uint32_t v, volatile uint32_t* a) { *a = v; return 0; }
+static inline void __CLREX(void) {}
+static inline uint32_t SysTick_Config(uint32_t t) { (void)t; return 0; }
+static inline void NVIC_SetPriority(IRQn_Type i, uint32_t p) { (void)i; (void)p; }
+static inline void NVIC_EnableIRQ(IRQn_Type i) { (void)i; }
+static inline void NVIC_DisableIRQ(IRQn_Type i) { (void)i; }
+static inline void NVIC_SetPendingIRQ(IRQn_Type i) { (void)i; }
+static inline uint32_t NVIC_EncodePriority(uint32_t g, uint32_t p, uint32_t s) { return g+p+s; }
+static inline uint32_t NVIC_GetPriorityGrouping(void) { return 0; }
+void SystemInit(void);
+void SystemCoreClockUpdate(void);
+extern uint32_t SystemCoreClock;
+#endif
@@ -0,0 +1,365 @@
+/*
+ * ȣƮ  StdPeriph ּ 뿪,   ְ Լ Ǵ 
+ *  --gc-sections ũϹǷ  ʴ Լ θ ֺġ Լ ũ 
+ *   ϸ  ̶  ̺귯 ٸ  
+ */
+#ifndef _STM32F4XX_CONF_H_
+#define _STM32F4XX_CONF_H_
+#include <stm32f4xx.h>
+/* RCC */
+typedef struct { uint32_t SYSCLK_Frequency, HCLK_Frequency, PCLK1_Frequency, PCLK2_Frequency; } RCC_ClocksTypeDef;
+void RCC_GetClocksFreq(RCC_ClocksTypeDef*);
+void RCC_AHB1PeriphClockCmd(uint32_t, FunctionalState);
+void RCC_APB1PeriphClockCmd(uint32_t, FunctionalState);
+void RCC_APB2PeriphClockCmd(uint32_t, FunctionalState);
+void RCC_HSEConfig(uint8_t); ErrorStatus RCC_WaitForHSEStartUp(void); void RCC_HSICmd(FunctionalState);
+void RCC_PLLConfig(uint32_t, uint32_t, uint32_t, uint32_t, uint32_t); void RCC_PLLCmd(FunctionalState);
+FlagStatus RCC_GetFlagStatus(uint8_t); void RCC_SYSCLKConfig(uint32_t); uint8_t RCC_GetSYSCLKSource(void);
+void RCC_HCLKConfig(uint32_t); void RCC_PCLK1Config(uint32_t); void RCC_PCLK2Config(uint32_t);
+#define RCC_HSE_ON 1
+#define RCC_PLLSource_HSI 0
+#define RCC_PLLSource_HSE (1<<22)
+#define RCC_FLAG_PLLRDY 0x39
+#define RCC_FLAG_HSIRDY 0x21
+#define RCC_SYSCLKSource_HSI 0
+#define RCC_SYSCLKSource_HSE 1
+#define RCC_SYSCLKSource_PLLCLK 2
+#define RCC_SYSCLK_Div1 0
+#define RCC_HCLK_Div1 0
+#define RCC_HCLK_Div2 0x1000
+#define RCC_HCLK_Div4 0x1400
+#define RCC_HCLK_Div8 0x1800
+#define RCC_HCLK_Div16 0x1C00
+#define RCC_AHB1Periph_GPIOA 1
+#define RCC_AHB1Periph_GPIOB 2
+#define RCC_AHB1Periph_GPIOC 4
+#define RCC_AHB1Periph_GPIOD 8
+#define RCC_AHB1Periph_CCMDATARAMEN (1<<20)
+#define RCC_AHB1Periph_DMA1 (1<<21)
+#define RCC_AHB1Periph_DMA2 (1<<22)
+#define RCC_APB1Periph_TIM2 1
+#define RCC_APB1Periph_TIM3 2
+#define RCC_APB1Periph_TIM4 4
+#define RCC_APB1Periph_TIM5 8
+#define RCC_APB1Periph_TIM7 0x20
+#define RCC_APB1Periph_TIM12 0x40
+#define RCC_APB1Periph_USART2 (1<<17)
+#define RCC_APB1Periph_USART3 (1<<18)
+#define RCC_APB1Periph_UART4 (1<<19)
+#define RCC_APB1Periph_UART5 (1<<20)
+#define RCC_APB1Periph_I2C1 (1<<21)
+#define RCC_APB1Periph_I2C2 (1<<22)
+#define RCC_APB1Periph_PWR (1<<28)
+#define RCC_APB2Periph_TIM1 1
+#define RCC_APB2Periph_TIM8 2
+#define RCC_APB2Periph_USART1 0x10
+#define RCC_APB2Periph_USART6 0x20
+#define RCC_APB2Periph_SYSCFG (1<<14)
+#define RCC_APB2Periph_TIM9 (1<<16)
+/* GPIO */
+typedef enum { GPIO_Mode_IN=0, GPIO_Mode_OUT, GPIO_Mode_AF, GPIO_Mode_AN } GPIOMode_TypeDef;
+typedef enum { GPIO_OType_PP=0, GPIO_OType_OD } GPIOOType_TypeDef;
+typedef enum { GPIO_Speed_2MHz=0, GPIO_Speed_25MHz, GPIO_Speed_50MHz, GPIO_Speed_100MHz } GPIOSpeed_TypeDef;
+typedef enum { GPIO_PuPd_NOPULL=0, GPIO_PuPd_UP, GPIO_PuPd_DOWN } GPIOPuPd_TypeDef;
+typedef struct { uint32_t GPIO_Pin; GPIOMode_TypeDef GPIO_Mode; GPIOSpeed_TypeDef GPIO_Speed; GPIOOType_TypeDef GPIO_OType; GPIOPuPd_TypeDef GPIO_PuPd; } GPIO_InitTypeDef;
+void GPIO_Init(GPIO_TypeDef*, GPIO_InitTypeDef*);
+void GPIO_PinAFConfig(GPIO_TypeDef*, uint16_t, uint8_t);
+uint8_t GPIO_ReadInputDataBit(GPIO_TypeDef*, uint16_t);
+void GPIO_SetBits(GPIO_TypeDef*, uint16_t); void GPIO_ResetBits(GPIO_TypeDef*, uint16_t);
+#define GPIO_Pin_0 0x0001
+#define GPIO_Pin_1 0x0002
+#define GPIO_Pin_2 0x0004
+#define GPIO_Pin_3 0x0008
+#define GPIO_Pin_4 0x0010
+#define GPIO_Pin_5 0x0020
+#define GPIO_Pin_6 0x0040
+#define GPIO_Pin_7 0x0080
+#define GPIO_Pin_8 0x0100
+#define GPIO_Pin_9 0x0200
+#define GPIO_Pin_10 0x0400
+#define GPIO_Pin_11 0x0800
+#define GPIO_Pin_12 0x1000
+#define GPIO_Pin_13 0x2000
+#define GPIO_Pin_14 0x4000
+#define GPIO_Pin_15 0x8000
+#define GPIO_PinSource0 0
+#define GPIO_PinSource1 1
+#define GPIO_PinSource2 2
+#define GPIO_PinSource3 3
+#define GPIO_PinSource4 4
+#define GPIO_PinSource5 5
+#define GPIO_PinSource6 6
+#define GPIO_PinSource7 7
+#define GPIO_PinSource8 8
+#define GPIO_PinSource9 9
+#define GPIO_PinSource10 10
+#define GPIO_PinSource11 11
+#define GPIO_PinSource12 12
+#define GPIO_PinSource13 13
+#define GPIO_PinSource14 14
+#define GPIO_PinSource15 15
+#define GPIO_AF_TIM1 1
+#define GPIO_AF_TIM2 1
+#define GPIO_AF_TIM3 2
+#define GPIO_AF_TIM4 2
+#define GPIO_AF_TIM5 2
+#define GPIO_AF_TIM8 3
+#define GPIO_AF_TIM9 3
+#define GPIO_AF_I2C1 4
+#define GPIO_AF_I2C2 4
+#define GPIO_AF_USART1 7
+#define GPIO_AF_USART2 7
+#define GPIO_AF_USART3 7
+#define GPIO_AF_UART4 8
+#define GPIO_AF_UART5 8
+#define GPIO_AF_USART6 8
+/* USART */
+typedef struct { uint32_t USART_BaudRate; uint16_t USART_WordLength, USART_StopBits, USART_Parity, USART_Mode, USART_HardwareFlowControl; } USART_InitTypeDef;
+void USART_Init(USART_TypeDef*, USART_InitTypeDef*); void USART_Cmd(USART_TypeDef*, FunctionalState);
+void USART_ITConfig(USART_TypeDef*, uint16_t, FunctionalState); ITStatus USART_GetITStatus(USART_TypeDef*, uint16_t);
+void USART_SendData(USART_TypeDef*, uint16_t); uint16_t USART_ReceiveData(USART_TypeDef*);
+void USART_DMACmd(USART_TypeDef*, uint16_t, FunctionalState); void USART_ClearITPendingBit(USART_TypeDef*, uint16_t);
+#define USART_WordLength_8b 0
+#define USART_WordLength_9b 0x1000
+#define USART_StopBits_1 0
+#define USART_StopBits_2 0x2000
+#define USART_Parity_No 0
+#define USART_Parity_Even 0x400
+#define USART_Parity_Odd 0x600
+#define USART_HardwareFlowControl_None 0
+#define USART_Mode_Rx 4
+#define USART_Mode_Tx 8
+#define USART_IT_RXNE 0x0525
+#define USART_IT_TXE 0x0727
+#define USART_IT_IDLE 0x0424
+#define USART_IT_PE 0x0028
+#define USART_IT_ORE_RX 0x0325
+#define USART_IT_FE 0x0160
+#define USART_DMAReq_Rx 0x40
+#define USART_DMAReq_Tx 0x80
+/* NVIC */
+typedef struct { uint8_t NVIC_IRQChannel, NVIC_IRQChannelPreemptionPriority, NVIC_IRQChannelSubPriority; FunctionalState NVIC_IRQChannelCmd; } NVIC_InitTypeDef;
+void NVIC_Init(NVIC_InitTypeDef*);
+/* EXTI */
+typedef enum { EXTI_Mode_Interrupt=0, EXTI_Mode_Event=4 } EXTIMode_TypeDef;
+typedef enum { EXTI_Trigger_Rising=8, EXTI_Trigger_Falling=0xC, EXTI_Trigger_Rising_Falling=0x10 } EXTITrigger_TypeDef;
+typedef struct { uint32_t EXTI_Line; EXTIMode_TypeDef EXTI_Mode; EXTITrigger_TypeDef EXTI_Trigger; FunctionalState EXTI_LineCmd; } EXTI_InitTypeDef;
+void EXTI_Init(EXTI_InitTypeDef*); ITStatus EXTI_GetITStatus(uint32_t); void EXTI_ClearITPendingBit(uint32_t);
+void SYSCFG_EXTILineConfig(uint8_t, uint8_t);
+#define EXTI_Line0 1
+#define EXTI_Line1 2
+#define EXTI_Line2 4
+#define EXTI_Line3 8
+#define EXTI_Line4 0x10
+#define EXTI_Line5 0x20
+#define EXTI_Line6 0x40
+#define EXTI_Line7 0x80
+#define EXTI_Line8 0x100
+#define EXTI_Line9 0x200
+#define EXTI_Line10 0x400
+#define EXTI_Line11 0x800
+#define EXTI_Line12 0x1000
+#define EXTI_Line13 0x2000
+#define EXTI_Line14 0x4000
+#define EXTI_Line15 0x8000
+#define EXTI_PortSourceGPIOA 0
+#define EXTI_PortSourceGPIOB 1
+#define EXTI_PortSourceGPIOC 2
+#define EXTI_PortSourceGPIOD 3
+#define EXTI_PinSource0 0
+#define EXTI_PinSource1 1
+#define EXTI_PinSource2 2
+#define EXTI_PinSource3 3
+#define EXTI_PinSource4 4
+#define EXTI_PinSource5 5
+#define EXTI_PinSource6 6
+#define EXTI_PinSource7 7
+#define EXTI_PinSource8 8
+#define EXTI_PinSource9 9
+#define EXTI_PinSource10 10
+#define EXTI_PinSource11 11
+#define EXTI_PinSource12 12
+#define EXTI_PinSource13 13
+#define EXTI_PinSource14 14
+#define EXTI_PinSource15 15
+/* I2C */
+typedef struct { uint32_t I2C_ClockSpeed; uint16_t I2C_Mode, I2C_DutyCycle, I2C_OwnAddress1, I2C_Ack, I2C_AcknowledgedAddress; } I2C_InitTypeDef;
+void I2C_Init(I2C_TypeDef*, I2C_InitTypeDef*); void I2C_StructInit(I2C_InitTypeDef*); void I2C_DeInit(I2C_TypeDef*);
+void I2C_Cmd(I2C_TypeDef*, FunctionalState); void I2C_ITConfig(I2C_TypeDef*, uint16_t, FunctionalState);
+void I2C_GenerateSTART(I2C_TypeDef*, FunctionalState); void I2C_GenerateSTOP(I2C_TypeDef*, FunctionalState);
+void I2C_AcknowledgeConfig(I2C_TypeDef*, FunctionalState); void I2C_Send7bitAddress(I2C_TypeDef*, uint8_t, uint8_t);
+#define I2C_Mode_I2C 0
+#define I2C_DutyCycle_2 0xBFFF
+#define I2C_AcknowledgedAddress_7bit 0x4000
+#define I2C_IT_BUF 0x400
+#define I2C_IT_EVT 0x200
+#define I2C_IT_ERR 0x100
+#define I2C_FLAG_SB 1
+#define I2C_FLAG_ADDR 2
+#define I2C_FLAG_BTF 4
+#define I2C_FLAG_RXNE 0x40
+#define I2C_FLAG_TXE 0x80
+#define I2C_FLAG_ARLO 0x200
+#define I2C_Direction_Transmitter 0
+#define I2C_Direction_Receiver 1
+/* TIM */
+typedef struct { uint16_t TIM_Prescaler, TIM_CounterMode; uint32_t TIM_Period; uint16_t TIM_ClockDivision; uint8_t TIM_RepetitionCounter; } TIM_TimeBaseInitTypeDef;
+typedef struct { uint16_t TIM_OCMode, TIM_OutputState, TIM_OutputNState; uint32_t TIM_Pulse; uint16_t TIM_OCPolarity, TIM_OCNPolarity, TIM_OCIdleState, TIM_OCNIdleState; } TIM_OCInitTypeDef;
+typedef struct { uint16_t TIM_Channel, TIM_ICPolarity, TIM_ICSelection, TIM_ICPrescaler, TIM_ICFilter; } TIM_ICInitTypeDef;
+void TIM_TimeBaseInit(TIM_TypeDef*, TIM_TimeBaseInitTypeDef*); void TIM_TimeBaseStructInit(TIM_TimeBaseInitTypeDef*);
+void TIM_OCStructInit(TIM_OCInitTypeDef*); void TIM_ICStructInit(TIM_ICInitTypeDef*);
+void TIM_OC1Init(TIM_TypeDef*, TIM_OCInitTypeDef*); void TIM_OC2Init(TIM_TypeDef*, TIM_OCInitTypeDef*);
+void TIM_OC3Init(TIM_TypeDef*, TIM_OCInitTypeDef*); void TIM_OC4Init(TIM_TypeDef*, TIM_OCInitTypeDef*);
+void TIM_OC1PreloadConfig(TIM_TypeDef*, uint16_t); void TIM_OC2PreloadConfig(TIM_TypeDef*, uint16_t);
+void TIM_OC3PreloadConfig(TIM_TypeDef*, uint16_t); void TIM_OC4PreloadConfig(TIM_TypeDef*, uint16_t);
+void TIM_ICInit(TIM_TypeDef*, TIM_ICInitTypeDef*); void TIM_Cmd(TIM_TypeDef*, FunctionalState);
+void TIM_ITConfig(TIM_TypeDef*, uint16_t, FunctionalState); ITStatus TIM_GetITStatus(TIM_TypeDef*, uint16_t);
+void TIM_ClearITPendingBit(TIM_TypeDef*, uint16_t); void TIM_DMACmd(TIM_TypeDef*, uint16_t, FunctionalState);
+void TIM_DMAConfig(TIM_TypeDef*, uint16_t, uint16_t); void TIM_ARRPreloadConfig(TIM_TypeDef*, FunctionalState);
+void TIM_CtrlPWMOutputs(TIM_TypeDef*, FunctionalState); void TIM_GenerateEvent(TIM_TypeDef*, uint16_t);
+void TIM_SelectOnePulseMode(TIM_TypeDef*, uint16_t); void TIM_DeInit(TIM_TypeDef*);
+#define TIM_CounterMode_Up 0
+#define TIM_CKD_DIV1 0
+#define TIM_OCMode_PWM1 0x60
+#define TIM_OCMode_PWM2 0x70
+#define TIM_OutputState_Enable 1
+#define TIM_OutputState_Disable 0
+#define TIM_OutputNState_Disable 0
+#define TIM_OCPolarity_High 0
+#define TIM_OCPolarity_Low 2
+#define TIM_OCIdleState_Set 0x100
+#define TIM_OCIdleState_Reset 0
+#define TIM_OCPreload_Enable 8
+#define TIM_Channel_1 0
+#define TIM_Channel_2 4
+#define TIM_Channel_3 8
+#define TIM_Channel_4 0xC
+#define TIM_ICPolarity_Rising 0
+#define TIM_ICPolarity_Falling 2
+#define TIM_ICPolarity_BothEdge 0xA
+#define TIM_ICSelection_DirectTI 1
+#define TIM_ICSelection_IndirectTI 2
+#define TIM_ICPSC_DIV1 0
+#define TIM_IT_Update 1
+#define TIM_IT_CC1 2
+#define TIM_IT_CC2 4
+#define TIM_IT_CC3 8
+#define TIM_IT_CC4 0x10
+#define TIM_DMA_Update 0x100
+#define TIM_DMA_CC1 0x200
+#define TIM_DMA_CC2 0x400
+#define TIM_DMA_CC3 0x800
+#define TIM_DMA_CC4 0x1000
+#define TIM_DMABase_CCR1 0xD
+#define TIM_DMABurstLength_1Transfer 0
+#define TIM_DMABurstLength_4Transfers 0x300
+#define TIM_EventSource_Update 1
+#define TIM_OPMode_Single 8
+/* DMA */
+typedef struct { uint32_t DMA_Channel, DMA_PeripheralBaseAddr, DMA_Memory0BaseAddr, DMA_DIR, DMA_BufferSize, DMA_PeripheralInc, DMA_MemoryInc, DMA_PeripheralDataSize, DMA_MemoryDataSize, DMA_Mode, DMA_Priority, DMA_FIFOMode, DMA_FIFOThreshold, DMA_MemoryBurst, DMA_PeripheralBurst; } DMA_InitTypeDef;
+void DMA_Init(DMA_Stream_TypeDef*, DMA_InitTypeDef*); void DMA_StructInit(DMA_InitTypeDef*); void DMA_DeInit(DMA_Stream_TypeDef*);
+void DMA_Cmd(DMA_Stream_TypeDef*, FunctionalState); void DMA_SetCurrDataCounter(DMA_Stream_TypeDef*, uint16_t);
+uint16_t DMA_GetCurrDataCounter(DMA_Stream_TypeDef*); void DMA_ITConfig(DMA_Stream_TypeDef*, uint32_t, FunctionalState);
+ITStatus DMA_GetITStatus(DMA_Stream_TypeDef*, uint32_t); void DMA_ClearITPendingBit(DMA_Stream_TypeDef*, uint32_t);
+FunctionalState DMA_GetCmdStatus(DMA_Stream_TypeDef*); void DMA_ClearFlag(DMA_Stream_TypeDef*, uint32_t);
+#define DMA_Channel_0 0
+#define DMA_Channel_1 0x02000000
+#define DMA_Channel_2 0x04000000
+#define DMA_Channel_3 0x06000000
+#define DMA_Channel_4 0x08000000
+#define DMA_Channel_5 0x0A000000
+#define DMA_Channel_6 0x0C000000
+#define DMA_Channel_7 0x0E000000
+#define DMA_DIR_PeripheralToMemory 0
+#define DMA_DIR_MemoryToPeripheral 0x40
+#define DMA_PeripheralInc_Disable 0
+#define DMA_MemoryInc_Enable 0x400
+#define DMA_PeripheralDataSize_Byte 0
+#define DMA_PeripheralDataSize_HalfWord 0x800
+#define DMA_PeripheralDataSize_Word 0x1000
+#define DMA_MemoryDataSize_Byte 0
+#define DMA_MemoryDataSize_HalfWord 0x2000
+#define DMA_MemoryDataSize_Word 0x4000
+#define DMA_Mode_Normal 0
+#define DMA_Mode_Circular 0x100
+#define DMA_Priority_High 0x20000
+#define DMA_Priority_VeryHigh 0x30000
+#define DMA_FIFOMode_Disable 0
+#define DMA_FIFOMode_Enable 4
+#define DMA_FIFOThreshold_Full 3
+#define DMA_FIFOThreshold_1QuarterFull 0
+#define DMA_MemoryBurst_Single 0
+#define DMA_PeripheralBurst_Single 0
+#define DMA_IT_TC 0x10
+#define DMA_IT_HT 0x08
+/* FLASH */
+typedef enum { FLASH_BUSY = 1, FLASH_ERROR_RD, FLASH_ERROR_PGS, FLASH_ERROR_PGP, FLASH_ERROR_PGA, FLASH_ERROR_WRP, FLASH_ERROR_PROGRAM, FLASH_ERROR_OPERATION, FLASH_COMPLETE } FLASH_Status;
+void FLASH_Unlock(void); void FLASH_Lock(void); FLASH_Status FLASH_EraseSector(uint32_t, uint8_t);
+FLASH_Status FLASH_ProgramWord(uint32_t, uint32_t); void FLASH_ClearFlag(uint32_t); void FLASH_SetLatency(uint32_t);
+void FLASH_PrefetchBufferCmd(FunctionalState); void FLASH_InstructionCacheCmd(FunctionalState); void FLASH_DataCacheCmd(FunctionalState);
+#define FLASH_Sector_10 0x50
+#define FLASH_Sector_11 0x58
+#define VoltageRange_3 2
+#define FLASH_FLAG_EOP 1
+#define FLASH_FLAG_OPERR 2
+#define FLASH_FLAG_WRPERR 0x10
+#define FLASH_FLAG_PGAERR 0x20
+#define FLASH_FLAG_PGPERR 0x40
+#define FLASH_FLAG_PGSERR 0x80
+#define FLASH_Latency_0 0
+#define FLASH_Latency_5 5
+/* PWR */
+void PWR_MainRegulatorModeConfig(uint32_t);
+#define PWR_Regulator_Voltage_Scale1 0x4000
+#define PWR_Regulator_Voltage_Scale2 0
+/* misc */
+#define GPIO_AF_TIM12 9
+#define TIM_FLAG_CC1OF 0x200
+#define DMA_FLAG_TCIF5 0x20000800
+#define DMA_FLAG_HTIF5 0x20000400
+#define DMA_FLAG_TEIF5 0x20000200
+#define DMA_FLAG_DMEIF5 0x20000100
+#define DMA_FLAG_FEIF5 0x20000040
+#define DMA_FLAG_TCIF2 0x20000800
+#define DMA_FLAG_HTIF2 0x20000400
+#define DMA_FLAG_TEIF2 0x20000200
+#define DMA_FLAG_DMEIF2 0x20000100
+#define DMA_FLAG_FEIF2 0x20000040
+#define DMA_FLAG_TCIF3 0x20000800
+#define DMA_FLAG_HTIF3 0x20000400
+#define DMA_FLAG_TEIF3 0x20000200
+#define DMA_FLAG_DMEIF3 0x20000100
+#define DMA_FLAG_FEIF3 0x20000040
+#define DMA_FLAG_TCIF4 0x20000800
+#define DMA_FLAG_HTIF4 0x20000400
+#define DMA_FLAG_TEIF4 0x20000200
+#define DMA_FLAG_DMEIF4 0x20000100
+#define DMA_FLAG_FEIF4 0x20000040
+#define DMA_FLAG_TCIF6 0x20000800
+#define DMA_FLAG_HTIF6 0x20000400
+#define DMA_FLAG_TEIF6 0x20000200
+#define DMA_FLAG_DMEIF6 0x20000100
+#define DMA_FLAG_FEIF6 0x20000040
+#define TIM_CCMR1_CC1S_0 1
+#define TIM_DIER_CC1DE (1<<9)
+#define TIM_CR1_ARPE 0x80
+#define DMA_IT_TCIF5 0x20008000
+#define USART_SR_TXE 0x80
+#define assert_param(expr) ((void)0)
+#ifndef HSE_VALUE
+#define HSE_VALUE 8000000
+#endif
+#ifndef HSI_VALUE
+#define HSI_VALUE 16000000
+#endif
+void TIM_PrescalerConfig(TIM_TypeDef*, uint16_t, uint16_t);
+#define TIM_PSCReloadMode_Immediate 1
+#define RCC_SYSCLK_Div2 0x80
+#define RCC_SYSCLK_Div4 0x90
+#define RCC_SYSCLK_Div8 0xA0
+#define RCC_SYSCLK_Div16 0xB0
+#define RCC_SYSCLK_Div64 0xC0
+#define RCC_SYSCLK_Div128 0xD0
+#define RCC_SYSCLK_Div256 0xE0
+#define RCC_SYSCLK_Div512 0xF0
+#endif
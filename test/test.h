@@ -0,0 +1,31 @@
+#ifndef _TEST_H_
+#define _TEST_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*
+ * @brief  ̸ ġ ϰ з 
+ */
+#define CHECK(cond) do { \
+	if(!(cond)) { \
+		printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+		exit(1); \
+	} \
+} while(0)
+
+/*
+ * @brief ȣƮ  ð б, ġũ
+ * @note ȣƮ ð̶ Ÿ Ŭ ٸ, Ÿ    DWT  
+ * @param 
+ * @retval 
+ */
+static inline double hostNanos(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+#endif
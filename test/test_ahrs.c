@@ -0,0 +1,257 @@
+#include <math.h>
+#include <string.h>
+#include "test.h"
+#include <stm32f4xx.h>
+#include <stm32f4xx_conf.h>
+#include <mpu6050.h>
+#include <ahrs.h>
+
+/*
+ * ڼ   ġũ
+ *
+ * :
+ *     test_ahrs                  ռ  Ȯ Ȯ,  ѹ ȣƮ ð 
+ *     test_ahrs trace.csv ...     
+ *
+ *    ٿ  , # ϴ  
+ *     timeUs,ax,ay,az,gx,gy,gz[,roll,pitch,yaw]
+ * ӵ ̷δ mpu6050Read ִ ð(LSB),  ()   
+ */
+
+#define TRACE_HZ        1000
+#define TRACE_SETTLE_S  2.0  //  迡   ð
+#define ACC_LSB         (1.0 / ACCScaleFactor) // 1g
+#define DEG             (M_PI / 180.0)
+
+/*
+ * @brief  
+ */
+typedef struct {
+	uint32_t timeUs;
+	int16_t acc[3];
+	int16_t gyro[3];
+	float ref[3]; //  Ϸ(), hasRef϶
+	int hasRef;
+} traceSample_t;
+
+/*
+ * @brief  
+ */
+typedef struct {
+	double rms[3]; // ະ  RMS()
+	double max[3]; // ະ ִ ()
+	double nsPerUpdate;
+	float last[3];
+} traceResult_t;
+
+/*
+ * @brief ռ  
+ */
+typedef struct {
+	const char* name;
+	double seconds;
+	double rollAmp, pitchAmp, yawRate; // , , /
+	double gyroNoise, accNoise;        // ð ǥ(LSB)
+	double gyroBias[3];                // /
+	double linAcc;                     // ü x ӵ (g), ӵ 
+	double maxTilt, maxYaw;            //  ִ (), /ġ 
+} traceScenario_t;
+
+static const traceScenario_t scenarios[] = {
+	{ "level",     10.0,  0.0,  0.0,   0.0, 4.0, 8.0, { 0.0, 0.0, 0.0 }, 0.0, 0.2, 0.2 },
+	{ "sway",      20.0, 30.0, 20.0,   0.0, 4.0, 8.0, { 0.0, 0.0, 0.0 }, 0.0, 0.5, 0.5 },
+	{ "turn",      20.0, 20.0, 15.0,  90.0, 4.0, 8.0, { 0.0, 0.0, 0.0 }, 0.0, 0.5, 0.5 },
+	{ "bias",      20.0, 10.0, 10.0,   0.0, 4.0, 8.0, { 0.5, -0.5, 0.0 }, 0.0, 1.5, 1.0 },
+	{ "vibration", 20.0, 20.0, 15.0,  45.0, 8.0, 8.0, { 0.0, 0.0, 0.0 }, 0.3, 1.0, 0.5 },
+};
+
+/*
+ * @brief Ժ (Box-Muller),  ϵ õ 
+ */
+static double gaussian(void) {
+	const double u1 = (rand() + 1.0) / (RAND_MAX + 2.0);
+	const double u2 = (rand() + 1.0) / (RAND_MAX + 2.0);
+	return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+static int16_t saturate(double v) {
+	v = floor(v + 0.5);
+	return (int16_t)(v > 32767.0 ? 32767.0 : (v < -32768.0 ? -32768.0 : v));
+}
+
+/*
+ * @brief ռ  
+ * @note Ϸ(ZYX) ð Լ ΰ ̺ؼ ü ӵ üǥ ߷ 
+ */
+static uint32_t traceSynth(const traceScenario_t* s, traceSample_t* out) {
+	const uint32_t n = (uint32_t)(s->seconds * TRACE_HZ);
+	const double wRoll = 2.0 * M_PI * 0.37, wPitch = 2.0 * M_PI * 0.23;
+	uint32_t i;
+	srand(1);
+	for(i = 0; i < n; i++) {
+		const double t = (double)i / TRACE_HZ;
+		const double roll = s->rollAmp * DEG * sin(wRoll * t);
+		const double pitch = s->pitchAmp * DEG * sin(wPitch * t);
+		const double yaw = s->yawRate * DEG * t;
+		const double dRoll = s->rollAmp * DEG * wRoll * cos(wRoll * t);
+		const double dPitch = s->pitchAmp * DEG * wPitch * cos(wPitch * t);
+		const double dYaw = s->yawRate * DEG;
+
+		const double p = dRoll - dYaw * sin(pitch);
+		const double q = dPitch * cos(roll) + dYaw * cos(pitch) * sin(roll);
+		const double r = -dPitch * sin(roll) + dYaw * cos(pitch) * cos(roll);
+		const double rate[3] = { p, q, r };
+
+		double acc[3] = { -sin(pitch), sin(roll) * cos(pitch), cos(roll) * cos(pitch) };
+		acc[0] += s->linAcc * sin(2.0 * M_PI * 7.0 * t);
+
+		uint8_t k;
+		traceSample_t* sample = &out[i];
+		sample->timeUs = i * (1000000 / TRACE_HZ);
+		for(k = 0; k < 3; k++) {
+			sample->acc[k] = saturate(acc[k] * ACC_LSB + s->accNoise * gaussian());
+			sample->gyro[k] = saturate((rate[k] / DEG + s->gyroBias[k]) / GYROScaleFactor + s->gyroNoise * gaussian());
+		}
+		double wrapped = fmod(yaw / DEG + 180.0, 360.0);
+		sample->ref[AHRS_ROLL] = roll / DEG;
+		sample->ref[AHRS_PITCH] = pitch / DEG;
+		sample->ref[AHRS_YAW] = (wrapped < 0.0 ? wrapped + 360.0 : wrapped) - 180.0;
+		sample->hasRef = 1;
+	}
+	return n;
+}
+
+/*
+ * @brief   б
+ * @retval  , ϸ 0
+ */
+static uint32_t traceLoad(const char* path, traceSample_t** out) {
+	FILE* f = fopen(path, "r");
+	if(f == NULL) {
+		return 0;
+	}
+	uint32_t n = 0, cap = 4096;
+	traceSample_t* buf = malloc(cap * sizeof(traceSample_t));
+	char line[256];
+	while(fgets(line, sizeof(line), f) != NULL) {
+		if(line[0] == '#' || line[0] == '\n') {
+			continue;
+		}
+		unsigned long t;
+		int a[3], g[3];
+		float ref[3];
+		const int fields = sscanf(line, "%lu,%d,%d,%d,%d,%d,%d,%f,%f,%f", &t, &a[0], &a[1], &a[2], &g[0], &g[1], &g[2], &ref[0], &ref[1], &ref[2]);
+		if(fields != 7 && fields != 10) {
+			continue;
+		}
+		if(n == cap) {
+			cap *= 2;
+			buf = realloc(buf, cap * sizeof(traceSample_t));
+		}
+		traceSample_t* sample = &buf[n++];
+		uint8_t k;
+		sample->timeUs = (uint32_t)t;
+		for(k = 0; k < 3; k++) {
+			sample->acc[k] = (int16_t)a[k];
+			sample->gyro[k] = (int16_t)g[k];
+			sample->ref[k] = (fields == 10) ? ref[k] : 0.0f;
+		}
+		sample->hasRef = (fields == 10);
+	}
+	fclose(f);
+	*out = buf;
+	return n;
+}
+
+/*
+ * @brief  
+ * @note Ȯ   ð ں, ð  ü ÿ 
+ */
+static void traceReplay(ahrsType_t type, const traceSample_t* trace, uint32_t n, traceResult_t* result) {
+	ahrsInitTypeDef_t ahrsInitStruct;
+	ahrsStructInit(&ahrsInitStruct);
+	ahrsInitStruct.type = type;
+	ahrsInitStruct.sampleHz = TRACE_HZ;
+	ahrsInit(&ahrsInitStruct);
+
+	memset(result, 0, sizeof(traceResult_t));
+	uint32_t i, counted = 0;
+	double spent = 0.0;
+	const uint32_t settleUs = (uint32_t)(TRACE_SETTLE_S * 1e6);
+	for(i = 0; i < n; i++) {
+		const double start = hostNanos();
+		ahrsUpdate(trace[i].acc, trace[i].gyro, trace[i].timeUs);
+		spent += hostNanos() - start;
+
+		float angle[3];
+		ahrsGetEuler(angle);
+		memcpy(result->last, angle, sizeof(angle));
+		if(!trace[i].hasRef || trace[i].timeUs - trace[0].timeUs < settleUs) {
+			continue;
+		}
+		uint8_t k;
+		for(k = 0; k < 3; k++) {
+			double e = fabs(angle[k] - trace[i].ref[k]);
+			if(e > 180.0) {
+				e = 360.0 - e;
+			}
+			result->rms[k] += e * e;
+			if(e > result->max[k]) {
+				result->max[k] = e;
+			}
+		}
+		counted++;
+	}
+	uint8_t k;
+	for(k = 0; k < 3 && counted > 0; k++) {
+		result->rms[k] = sqrt(result->rms[k] / counted);
+	}
+	result->nsPerUpdate = spent / n;
+}
+
+static void tracePrint(const char* name, ahrsType_t type, const traceResult_t* r, int hasRef) {
+	printf("%-10s %-8s %6.1f ns", name, type == AHRS_MAHONY ? "mahony" : "madgwick", r->nsPerUpdate);
+	if(hasRef) {
+		printf("  rms r/p/y %5.2f %5.2f %5.2f  max %5.2f %5.2f %5.2f deg\n", r->rms[0], r->rms[1], r->rms[2], r->max[0], r->max[1], r->max[2]);
+	}
+	else {
+		printf("  final r/p/y %7.2f %7.2f %7.2f deg\n", r->last[0], r->last[1], r->last[2]);
+	}
+}
+
+int main(int argc, char** argv) {
+	const ahrsType_t types[] = { AHRS_MAHONY, AHRS_MADGWICK };
+	traceResult_t result;
+	uint8_t t;
+	int i;
+
+	if(argc > 1) {
+		for(i = 1; i < argc; i++) {
+			traceSample_t* trace;
+			const uint32_t n = traceLoad(argv[i], &trace);
+			CHECK(n > 0);
+			for(t = 0; t < 2; t++) {
+				traceReplay(types[t], trace, n, &result);
+				tracePrint(argv[i], types[t], &result, trace[n - 1].hasRef);
+			}
+			free(trace);
+		}
+		return 0;
+	}
+
+	for(i = 0; i < (int)(sizeof(scenarios) / sizeof(scenarios[0])); i++) {
+		const traceScenario_t* s = &scenarios[i];
+		traceSample_t* trace = malloc((size_t)(s->seconds * TRACE_HZ) * sizeof(traceSample_t));
+		const uint32_t n = traceSynth(s, trace);
+		for(t = 0; t < 2; t++) {
+			traceReplay(types[t], trace, n, &result);
+			tracePrint(s->name, types[t], &result, 1);
+			CHECK(result.max[AHRS_ROLL] < s->maxTilt);
+			CHECK(result.max[AHRS_PITCH] < s->maxTilt);
+			CHECK(result.max[AHRS_YAW] < s->maxYaw);
+		}
+		free(trace);
+	}
+	puts("ahrs ok");
+	return 0;
+}
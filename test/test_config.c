@@ -0,0 +1,236 @@
+#include <string.h>
+#include "test.h"
+#include <config.h>
+
+/*
+ *   
+ *  迭 ÷  ͸ 䳻 configFlash_t 鿣 ٽ б,   ,
+ *  ܰ踶   츦 Ȯ
+ *
+ * 䳻 ÷ Ģ:
+ *     erase ͸ 0xff, program  忡(1 -> 0), 4Ʈ 
+ *        ° erase/program Ͼ     
+ *     ܵ program Ϻ Ʈ   ְ, ܵ erase   ݸ 
+ */
+
+#define SIM_SECTOR_SIZE 1024 //   Ͼ ۰
+#define SIM_NO_CUT      0xffffffff
+
+/*
+ * @brief 䳻 ÷ 
+ */
+static struct {
+	uint32_t mem[2][SIM_SECTOR_SIZE / 4];
+	uint32_t erases[2];
+	uint32_t steps;   // ݱ erase/program 
+	uint32_t cutStep; //  ° ⿡  , SIM_NO_CUT̸ 
+	uint32_t torn;    // ܵ program  Ʈ, 1 Ʈ  
+	bool dead;        //  
+} sim;
+
+/*
+ * @brief ̹   
+ */
+typedef enum {
+	SIM_POWER_ON = 0,
+	SIM_POWER_CUT, //   ߿ 
+	SIM_POWER_OFF, // ̹ 
+} simPower_t;
+
+static simPower_t simStep(void) {
+	if(sim.dead) {
+		return SIM_POWER_OFF;
+	}
+	if(sim.steps++ == sim.cutStep) {
+		sim.dead = true;
+		return SIM_POWER_CUT;
+	}
+	return SIM_POWER_ON;
+}
+
+static bool simErase(uint8_t index) {
+	CHECK(index < 2);
+	const simPower_t power = simStep();
+	if(power != SIM_POWER_ON) {
+		if(power == SIM_POWER_CUT) {
+			memset(sim.mem[index], 0xff, SIM_SECTOR_SIZE / 2);
+		}
+		return false;
+	}
+	memset(sim.mem[index], 0xff, SIM_SECTOR_SIZE);
+	sim.erases[index]++;
+	return true;
+}
+
+static bool simProgram(const uint8_t* address, uint32_t data) {
+	const uintptr_t a = (uintptr_t)address;
+	uint8_t index;
+	for(index = 0; index < 2; index++) {
+		const uintptr_t base = (uintptr_t)sim.mem[index];
+		if(a >= base && a < base + SIM_SECTOR_SIZE) {
+			break;
+		}
+	}
+	CHECK(index < 2);
+	CHECK((a & 3) == 0);
+	uint32_t* word = &sim.mem[index][(a - (uintptr_t)sim.mem[index]) / 4];
+	CHECK(*word == 0xffffffff); //  忡 
+	const simPower_t power = simStep();
+	if(power != SIM_POWER_ON) {
+		if(power == SIM_POWER_CUT) {
+			*word &= data | sim.torn;
+		}
+		return false;
+	}
+	*word &= data;
+	return true;
+}
+
+static const configFlash_t simFlash = {
+	{ (const uint8_t*)sim.mem[0], (const uint8_t*)sim.mem[1] },
+	SIM_SECTOR_SIZE,
+	simErase,
+	simProgram,
+};
+
+/*
+ * @brief ٽ ѱ,   Ǯ Ҹ ٽ 
+ */
+static void simReboot(void) {
+	sim.dead = false;
+	sim.cutStep = SIM_NO_CUT;
+	CHECK(configInit(&simFlash) == SUCCESS);
+}
+
+/*
+ * @brief  ̷  ù ,  -1
+ */
+static int32_t biasGet(void) {
+	uint16_t len;
+	const int16_t* p = configGet(CONFIG_KEY_GYRO_BIAS, &len);
+	if(p == NULL) {
+		return -1;
+	}
+	CHECK(len == 6);
+	CHECK(p[1] == -p[0] && p[2] == 3);
+	return p[0];
+}
+
+static ErrorStatus biasSet(int16_t value) {
+	const int16_t bias[3] = { value, (int16_t)-value, 3 };
+	return configSet(CONFIG_KEY_GYRO_BIAS, bias, sizeof(bias));
+}
+
+/*
+ * @brief Ⱑ  ÷ÿ ,  ٽ б
+ */
+static void reload(void) {
+	memset(sim.mem, 0xa5, sizeof(sim.mem));
+	sim.steps = 0;
+	simReboot();
+	CHECK(configGet(CONFIG_KEY_GYRO_BIAS, NULL) == NULL);
+
+	CHECK(biasSet(100) == SUCCESS);
+	const uint8_t* p = configGet(CONFIG_KEY_GYRO_BIAS, NULL);
+	CHECK(p >= (const uint8_t*)sim.mem[0] && p < (const uint8_t*)sim.mem[0] + SIM_SECTOR_SIZE); //   ÷ø Ŵ
+	CHECK(biasGet() == 100);
+
+	const uint32_t steps = sim.steps;
+	CHECK(biasSet(100) == SUCCESS); //    
+	CHECK(sim.steps == steps);
+
+	simReboot();
+	CHECK(biasGet() == 100);
+}
+
+/*
+ * @brief    ͸  
+ */
+static void wear(void) {
+	configStat_t before, after;
+	configGetStat(&before);
+	memset(sim.erases, 0, sizeof(sim.erases));
+
+	int16_t i;
+	for(i = 1; i <= 2000; i++) {
+		CHECK(biasSet(i) == SUCCESS);
+		CHECK(biasGet() == i);
+	}
+	configGetStat(&after);
+	printf("2000 writes: erases %u/%u, generation %u -> %u\n", sim.erases[0], sim.erases[1], before.generation, after.generation);
+	CHECK(sim.erases[0] + sim.erases[1] == after.generation - before.generation);
+	CHECK(sim.erases[0] > 10);
+	CHECK(sim.erases[0] - sim.erases[1] + 1 <= 2); // ̰ 1 
+
+	simReboot();
+	CHECK(biasGet() == 2000);
+}
+
+/*
+ * @brief  ϳ  ܰ迡  
+ * @note   ٽ Ѹ   ̳    ϳ ϰ,   ⵵ Ǿ
+ * @param compact: ̹ Ⱑ  Ű ͸ ä
+ * @retval 
+ */
+static void powerLoss(bool compact) {
+	configStat_t stat;
+	int16_t fill = (int16_t)biasGet();
+
+	if(compact) {
+		for(;;) {
+			configGetStat(&stat);
+			if(stat.used + 16 > stat.size) {
+				break;
+			}
+			CHECK(biasSet(++fill) == SUCCESS);
+		}
+	}
+	const int16_t last = (int16_t)biasGet();
+	configGetStat(&stat);
+	const uint32_t generation = stat.generation;
+	static uint32_t saved[2][SIM_SECTOR_SIZE / 4];
+	memcpy(saved, sim.mem, sizeof(saved));
+
+	//  ʰ ܰ  
+	const uint32_t start = sim.steps;
+	CHECK(biasSet(last + 1000) == SUCCESS);
+	const uint32_t total = sim.steps - start;
+	configGetStat(&stat);
+	CHECK(stat.generation == generation + (compact ? 1 : 0));
+
+	const uint32_t torn[] = { 0xffffffff, 0x0000ffff, 0xffff0000, 0x5a5a5a5a };
+	uint32_t step, t, newCount = 0;
+	for(step = 0; step < total; step++) {
+		for(t = 0; t < sizeof(torn) / sizeof(torn[0]); t++) {
+			memcpy(sim.mem, saved, sizeof(saved));
+			simReboot();
+			CHECK(biasGet() == last);
+
+			sim.steps = 0;
+			sim.cutStep = step;
+			sim.torn = torn[t];
+			CHECK(biasSet(last + 1000) == ERROR);
+
+			simReboot();
+			const int32_t value = biasGet();
+			CHECK(value == last || value == last + 1000);
+			newCount += (value == last + 1000);
+
+			CHECK(biasSet(last + 2000) == SUCCESS); //   
+			CHECK(biasGet() == last + 2000);
+			simReboot();
+			CHECK(biasGet() == last + 2000);
+		}
+	}
+	printf("%s: power cut at each of %u steps x %u torn patterns ok (%u kept the new value)\n",
+		compact ? "compaction" : "append", total, (uint32_t)(sizeof(torn) / sizeof(torn[0])), newCount);
+}
+
+int main(void) {
+	reload();
+	wear();
+	powerLoss(false);
+	powerLoss(true);
+	puts("config ok");
+	return 0;
+}
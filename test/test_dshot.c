@@ -0,0 +1,245 @@
+#include <string.h>
+#include "test.h"
+#include <dshot.h>
+
+/*
+ * DShot Ŷ Ʈ Ÿ̹ 
+ * dshotPack ä DMA ۸ 䳻 Ÿ̸(PWM1, īƮ, CCR ε) ְ
+ *   ٽ Ʈ о Ŷ , ӵ Ϸ high  Ȯ
+ *   ESC  ڵ  ĸó  dshotDecode ٽ 
+ */
+
+#define DSHOT_BURSTS (DSHOT_DMA_LENGTH / 4) // Ʈ ̺Ʈ CCR1 ~ CCR4  
+
+/*
+ * @brief Ÿ̸ 䳻, ä ϳ   ƽ 
+ * @note Ʈ ̺Ʈ ε    DMA   ε忡 Ƿ ۴  ֱ ʰ 
+ * 		  DMA Ӷ Ÿ̸Ӵ ̹  ְ ε    0
+ * @param buf: DMA 
+ * @param channel: ä(0 ~ 3)
+ * @param level: ƽ  , (DSHOT_BURSTS + 1) * DSHOT_BIT_LENGTH
+ * @retval 
+ */
+static void timerSim(const uint32_t* buf, uint8_t channel, uint8_t* level) {
+	uint32_t preload = 0;
+	uint32_t period, cnt;
+	for(period = 0; period <= DSHOT_BURSTS; period++) {
+		const uint32_t ccr = preload; // Ʈ ̺Ʈ, ε -> 
+		if(period < DSHOT_BURSTS) {
+			preload = buf[period * 4 + channel]; // DMA  
+		}
+		for(cnt = 0; cnt < DSHOT_BIT_LENGTH; cnt++) {
+			level[period * DSHOT_BIT_LENGTH + cnt] = (cnt < ccr); // PWM1: CNT < CCR̸ Ȱ
+		}
+	}
+}
+
+/*
+ * @brief  Ʈ б
+ * @note ù ֱ   ֱ low ϰ, Ʈ high տ ̾ DSHOT_BIT_0 Ǵ DSHOT_BIT_1 ƽ
+ * @retval Ŷ,  Ʋ 0xffffffff
+ */
+static uint32_t waveDecode(const uint8_t* level) {
+	uint32_t packet = 0;
+	uint32_t period, cnt;
+	for(period = 0; period <= DSHOT_BURSTS; period++) {
+		uint32_t high = 0;
+		for(cnt = 0; cnt < DSHOT_BIT_LENGTH; cnt++) {
+			if(level[period * DSHOT_BIT_LENGTH + cnt]) {
+				if(cnt != high) {
+					return 0xffffffff; // high ֱ ó ̾ 
+				}
+				high++;
+			}
+		}
+		if(period == 0 || period > DSHOT_FRAME_BITS) {
+			if(high != 0) {
+				return 0xffffffff;
+			}
+		}
+		else if(high == DSHOT_BIT_0 || high == DSHOT_BIT_1) {
+			packet = (packet << 1) | (high == DSHOT_BIT_1);
+		}
+		else {
+			return 0xffffffff;
+		}
+	}
+	return packet;
+}
+
+/*
+ * @brief Ŷ 
+ */
+static void packet(void) {
+	CHECK(dshotPacket(1046, false) == 0x82c6);
+	CHECK(dshotPacket(0, false) == 0x0000);
+	CHECK(dshotPacket(DSHOT_THROTTLE_MAX, false) == 0xffee);
+
+	uint16_t value;
+	for(value = 0; value <= DSHOT_THROTTLE_MAX; value++) {
+		const uint16_t p = dshotPacket(value, value & 1);
+		CHECK((p >> 5) == value);
+		CHECK(((p >> 4) & 1) == (value & 1));
+		CHECK(((p ^ (p >> 4) ^ (p >> 8) ^ (p >> 12)) & 0x0f) == 0); //  Ϻ xor 0
+	}
+}
+
+/*
+ * @brief dshotPack ä ۸ Ÿ̸ӿ  ٽ б,  ä 
+ */
+static void waveform(void) {
+	const uint16_t values[4] = { 1046, DSHOT_THROTTLE_MIN, DSHOT_THROTTLE_MAX, 0 };
+	uint32_t buf[DSHOT_DMA_LENGTH];
+	uint8_t level[(DSHOT_BURSTS + 1) * DSHOT_BIT_LENGTH];
+	uint8_t ch;
+
+	memset(buf, 0, sizeof(buf));
+	for(ch = 0; ch < 4; ch++) {
+		dshotPack(dshotPacket(values[ch], ch == 3), buf + ch, 4);
+	}
+	for(ch = 0; ch < 4; ch++) {
+		timerSim(buf, ch, level);
+		CHECK(waveDecode(level) == dshotPacket(values[ch], ch == 3));
+	}
+}
+
+/*
+ * @brief ӵ Ϸ Ʈ 
+ * @note ԰ Ʈ 0 high 37.5%, Ʈ 1 high 75%,   뷫 10% ޾Ƶ̹Ƿ Ʈ  5% ̳ 䱸
+ */
+static void timing(void) {
+	const uint32_t clocks[] = { 168000000, 84000000 }; // APB2(TIM1, TIM8), APB1 Ÿ̸
+	const uint16_t rates[] = { 150, 300, 600 };         // kHz
+	const uint16_t prescalers[2][3] = { { 55, 27, 13 }, { 27, 13, 6 } };
+	uint8_t c, t;
+	for(c = 0; c < 2; c++) {
+		for(t = 0; t < 3; t++) {
+			const uint16_t psc = dshotPrescaler(clocks[c], (dshotType_t)t);
+			const double tick = (psc + 1) * 1e9 / clocks[c]; // ns
+			const double bit = tick * DSHOT_BIT_LENGTH;
+			const double t0h = tick * DSHOT_BIT_0, t1h = tick * DSHOT_BIT_1;
+			CHECK(psc == prescalers[c][t]);
+			CHECK((uint64_t)(psc + 1) * DSHOT_BIT_LENGTH * rates[t] * 1000 == clocks[c]); //  
+			CHECK(t0h / bit > 0.375 - 0.05 && t0h / bit < 0.375 + 0.05);
+			CHECK(t1h / bit > 0.75 - 0.05 && t1h / bit < 0.75 + 0.05);
+			printf("DShot%-3u %3u MHz: psc %2u, bit %7.1f ns, T0H %6.1f ns, T1H %6.1f ns, frame %5.2f us\n",
+				rates[t], clocks[c] / 1000000, psc, bit, t0h, t1h, bit * DSHOT_FRAME_BITS / 1000.0);
+		}
+	}
+}
+
+/*
+ * @brief GCR 4Ʈ -> 5Ʈ ȯǥ, ESC  ڵ
+ */
+static const uint8_t gcrEncode[16] = {
+	0x19, 0x1b, 0x12, 0x13, 0x1d, 0x15, 0x16, 0x17, 0x1a, 0x09, 0x0a, 0x0b, 0x1e, 0x0d, 0x0e, 0x0f,
+};
+
+/*
+ * @brief  16Ʈ  ĸó 
+ * @note ۺƮ 1 GCR 20Ʈ  1 Ʈ , Ʈ ϳ 1 << DSHOT_TELEMETRY_BIT_SHIFT ƽ
+ * 		   -jitter ~ +jitter ƽ ϰ, 16Ʈ īͶ start ħ 
+ * @param nibble: ֻ  Ϻ(: , üũ)
+ * @param start: ù  ĸó
+ * @param jitter:  鸲(ƽ)
+ * @param edge: ĸó  迭, DSHOT_TELEMETRY_BITS ̻
+ * @retval  
+ */
+static uint8_t gcrEdges(const uint8_t* nibble, uint16_t start, int jitter, uint16_t* edge) {
+	uint32_t gcr = 1;
+	uint8_t i, count = 0;
+	int8_t bit;
+	for(i = 0; i < 4; i++) {
+		gcr = (gcr << 5) | (nibble[i] < 16 ? gcrEncode[nibble[i]] : nibble[i] - 16); // 16 ̻ 5Ʈ ڵ带 ״
+	}
+	for(bit = DSHOT_TELEMETRY_BITS - 1; bit >= 0; bit--) {
+		if(gcr & (1UL << bit)) {
+			const int shake = jitter ? rand() % (2 * jitter + 1) - jitter : 0;
+			edge[count++] = (uint16_t)(start + (DSHOT_TELEMETRY_BITS - 1 - bit) * (1 << DSHOT_TELEMETRY_BIT_SHIFT) + shake);
+		}
+	}
+	return count;
+}
+
+/*
+ * @brief 12Ʈ  ùٸ  Ϻ
+ */
+static void telemetryNibbles(uint16_t value, uint8_t* nibble) {
+	nibble[0] = value >> 8;
+	nibble[1] = (value >> 4) & 0x0f;
+	nibble[2] = value & 0x0f;
+	nibble[3] = ~(nibble[0] ^ nibble[1] ^ nibble[2]) & 0x0f;
+}
+
+/*
+ * @brief 12Ʈ  ϴ eRPM
+ */
+static uint32_t telemetryErpm(uint16_t value) {
+	if(value == 0x0fff) {
+		return 0;
+	}
+	const uint32_t period = (uint32_t)(value & 0x01ff) << (value >> 9);
+	return period ? 60000000 / period : DSHOT_TELEMETRY_INVALID;
+}
+
+/*
+ * @brief    鸲 Բ ٽ б
+ */
+static void decode(void) {
+	uint16_t edge[DSHOT_TELEMETRY_EDGES];
+	uint8_t nibble[4];
+	uint32_t n;
+	srand(1);
+	for(n = 0; n < 100000; n++) {
+		const uint16_t value = rand() & 0x0fff;
+		telemetryNibbles(value, nibble);
+		const uint8_t count = gcrEdges(nibble, (uint16_t)rand(), 3, edge);
+		CHECK(count <= DSHOT_TELEMETRY_EDGES);
+		CHECK(dshotDecode(edge, count) == telemetryErpm(value));
+	}
+	printf("decode: 100000 random frames with +-3 tick jitter ok\n");
+}
+
+/*
+ * @brief Ʋ  DSHOT_TELEMETRY_INVALID
+ */
+static void decodeReject(void) {
+	uint16_t edge[DSHOT_TELEMETRY_EDGES];
+	uint8_t nibble[4];
+	uint8_t count;
+	const uint16_t value = (3 << 9) | 125; // 1000us, 60000 eRPM
+
+	telemetryNibbles(value, nibble);
+	count = gcrEdges(nibble, 0xfff0, 0, edge);
+	CHECK(dshotDecode(edge, count) == 60000);
+
+	// üũ
+	nibble[3] ^= 0x01;
+	count = gcrEdges(nibble, 0xfff0, 0, edge);
+	CHECK(dshotDecode(edge, count) == DSHOT_TELEMETRY_INVALID);
+
+	//  ʴ GCR ڵ(11111)
+	telemetryNibbles(value, nibble);
+	nibble[1] = 16 + 0x1f;
+	count = gcrEdges(nibble, 0xfff0, 0, edge);
+	CHECK(dshotDecode(edge, count) == DSHOT_TELEMETRY_INVALID);
+
+	//  :  ڿ   ,  ħ,  
+	telemetryNibbles(value, nibble);
+	count = gcrEdges(nibble, 0xfff0, 0, edge);
+	edge[count] = edge[count - 1] + (DSHOT_TELEMETRY_BITS + 2) * (1 << DSHOT_TELEMETRY_BIT_SHIFT);
+	CHECK(dshotDecode(edge, count + 1) == DSHOT_TELEMETRY_INVALID);
+	edge[count] = edge[count - 1];
+	CHECK(dshotDecode(edge, count + 1) == DSHOT_TELEMETRY_INVALID);
+	CHECK(dshotDecode(edge, 0) == DSHOT_TELEMETRY_INVALID);
+}
+
+int main(void) {
+	packet();
+	waveform();
+	timing();
+	decode();
+	decodeReject();
+	puts("dshot ok");
+	return 0;
+}
@@ -0,0 +1,170 @@
+#include <math.h>
+#include <string.h>
+#include "test.h"
+#include <fastmath.h>
+
+/*
+ *   Լ Ȯ  ˻ ġũ
+ *
+ * :
+ *     test_fastmath        Է  float FASTMATH_STRIDE ϳ ˻(make test)
+ *     test_fastmath -x      float ˻(make sweep), fastmath.h ִ  
+ *
+ *  libm double, atan2 Ⱥи 8 z = min/max  float  ˻
+ * ġũ ȣ ѹ ȣƮ ð libm float Լ 
+ */
+
+#define FASTMATH_STRIDE  97 // Ҽ  Ʈ ϰ ¹ 
+#define BENCH_COUNT      4096
+#define BENCH_ROUNDS     2000
+
+/*
+ * @brief fastmath.h  ִ
+ */
+#define BOUND_SIN     2.9e-7
+#define BOUND_ATAN2   1.2e-5
+#define BOUND_ASIN    3.0e-7
+#define BOUND_ACOS    4.4e-7
+#define BOUND_INVSQRT 4.8e-6
+
+static inline float bitsToFloat(uint32_t u) {
+	float f;
+	memcpy(&f, &u, sizeof(f));
+	return f;
+}
+
+static inline void track(double* maxErr, double e) {
+	if(e > *maxErr) {
+		*maxErr = e;
+	}
+}
+
+/*
+ * @brief  , -pi pi   
+ */
+static inline double angleError(double a, double b) {
+	const double e = fabs(a - b);
+	return (e > M_PI) ? 2.0 * M_PI - e : e;
+}
+
+static void sweep(uint32_t stride) {
+	const uint32_t twoPi = 0x40c90fdb; // 2*pi ٷ Ʒ float
+	const uint32_t one = 0x3f800000;
+	const uint32_t normalMin = 0x00800000, infinity = 0x7f800000;
+	double errSin = 0, errCos = 0, errAtan2 = 0, errAsin = 0, errAcos = 0, errInvSqrt = 0;
+	uint64_t u;
+
+	// sin, cos: |x| <= 2*pi
+	for(u = 0; u <= twoPi; u += stride) {
+		const float x = bitsToFloat((uint32_t)u);
+		track(&errSin, fabs(sinApprox(x) - sin((double)x)));
+		track(&errSin, fabs(sinApprox(-x) - sin(-(double)x)));
+		track(&errCos, fabs(cosApprox(x) - cos((double)x)));
+		track(&errCos, fabs(cosApprox(-x) - cos(-(double)x)));
+	}
+
+	// asin, acos: |x| <= 1
+	for(u = 0; u <= one; u += stride) {
+		const float x = bitsToFloat((uint32_t)u);
+		track(&errAsin, fabs(asinApprox(x) - asin((double)x)));
+		track(&errAsin, fabs(asinApprox(-x) - asin(-(double)x)));
+		track(&errAcos, fabs(acosApprox(x) - acos((double)x)));
+		track(&errAcos, fabs(acosApprox(-x) - acos(-(double)x)));
+	}
+
+	// atan2: Ⱥи鸶 (z, 1) 
+	for(u = 0; u <= one; u += stride) {
+		const float z = bitsToFloat((uint32_t)u);
+		uint8_t k;
+		for(k = 0; k < 8; k++) {
+			const float a = (k & 1) ? -z : z;
+			const float b = (k & 2) ? -1.0f : 1.0f;
+			const float y = (k & 4) ? b : a;
+			const float x = (k & 4) ? a : b;
+			track(&errAtan2, angleError(atan2Approx(y, x), atan2((double)y, (double)x)));
+		}
+	}
+
+	// invSqrt:  ȭ , 
+	for(u = normalMin; u < infinity; u += stride) {
+		const float x = bitsToFloat((uint32_t)u);
+		track(&errInvSqrt, fabs(invSqrt(x) * sqrt((double)x) - 1.0));
+	}
+
+	printf("sin     %.4g (bound %.3g)\n", errSin, BOUND_SIN);
+	printf("cos     %.4g (bound %.3g)\n", errCos, BOUND_SIN);
+	printf("atan2   %.4g (bound %.3g)\n", errAtan2, BOUND_ATAN2);
+	printf("asin    %.4g (bound %.3g)\n", errAsin, BOUND_ASIN);
+	printf("acos    %.4g (bound %.3g)\n", errAcos, BOUND_ACOS);
+	printf("invSqrt %.4g (bound %.3g, relative)\n", errInvSqrt, BOUND_INVSQRT);
+	CHECK(errSin <= BOUND_SIN);
+	CHECK(errCos <= BOUND_SIN);
+	CHECK(errAtan2 <= BOUND_ATAN2);
+	CHECK(errAsin <= BOUND_ASIN);
+	CHECK(errAcos <= BOUND_ACOS);
+	CHECK(errInvSqrt <= BOUND_INVSQRT);
+}
+
+/*
+ * @brief Ư
+ */
+static void edgeCases(void) {
+	CHECK(atan2Approx(0.0f, 0.0f) == 0.0f);
+	CHECK(fabs(atan2Approx(0.0f, -1.0f) - M_PI) < BOUND_ATAN2);
+	CHECK(fabs(atan2Approx(1.0f, 0.0f) - M_PI_2) < BOUND_ATAN2);
+	CHECK(fabs(asinApprox(2.0f) - M_PI_2) < BOUND_ASIN); //   ߶
+	CHECK(fabs(asinApprox(-2.0f) + M_PI_2) < BOUND_ASIN);
+	CHECK(fabs(acosApprox(-1.0f) - M_PI) < BOUND_ACOS);
+}
+
+/*
+ * @brief ġũ Է,   б  ϵ 迭
+ */
+static float benchIn[BENCH_COUNT], benchIn2[BENCH_COUNT];
+static volatile float benchSink;
+
+#define BENCH(name, expr) do { \
+	double start = hostNanos(); \
+	float acc = 0.0f; \
+	uint32_t r, i; \
+	for(r = 0; r < BENCH_ROUNDS; r++) { \
+		for(i = 0; i < BENCH_COUNT; i++) { \
+			const float x = benchIn[i], y = benchIn2[i]; \
+			(void)y; \
+			acc += (expr); \
+		} \
+	} \
+	benchSink = acc; \
+	printf("  %-12s %6.2f ns\n", name, (hostNanos() - start) / ((double)BENCH_ROUNDS * BENCH_COUNT)); \
+} while(0)
+
+static void benchmark(void) {
+	uint32_t i;
+	srand(1);
+	for(i = 0; i < BENCH_COUNT; i++) {
+		benchIn[i] = (rand() / (float)RAND_MAX) * 2.0f - 1.0f;
+		benchIn2[i] = (rand() / (float)RAND_MAX) * 2.0f - 1.0f;
+	}
+	printf("host time per call:\n");
+	BENCH("sinApprox", sinApprox(x * 3.0f));
+	BENCH("sinf", sinf(x * 3.0f));
+	BENCH("cosApprox", cosApprox(x * 3.0f));
+	BENCH("cosf", cosf(x * 3.0f));
+	BENCH("atan2Approx", atan2Approx(y, x));
+	BENCH("atan2f", atan2f(y, x));
+	BENCH("asinApprox", asinApprox(x));
+	BENCH("asinf", asinf(x));
+	BENCH("acosApprox", acosApprox(x));
+	BENCH("acosf", acosf(x));
+	BENCH("invSqrt", invSqrt(x + 2.0f));
+	BENCH("1/sqrtf", 1.0f / sqrtf(x + 2.0f));
+}
+
+int main(int argc, char** argv) {
+	const int exhaustive = (argc > 1 && strcmp(argv[1], "-x") == 0);
+	edgeCases();
+	sweep(exhaustive ? 1 : FASTMATH_STRIDE);
+	benchmark();
+	puts("fastmath ok");
+	return 0;
+}
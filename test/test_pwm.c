@@ -0,0 +1,141 @@
+#include <math.h>
+#include <string.h>
+#include "test.h"
+#include <system.h>
+
+/*
+ * pwm ű  
+ * pwmStore, pwmRead static̰ų ͷƮ θǷ pwm.c ״ ؼ  θ
+ * rc.h pwmType_t ǥ(50Hz ű, pwmRead 1kHz, 3us ) ٽ ؼ 
+ *     90%  ð: 1500 -> 1700us  ó    1680us 
+ *     1ms  ȭ rms: 1500us  
+ *     ũ: 1700us  Ӹ +150us϶   ִ밪
+ */
+#define SEQLOCK_BARRIER() __asm volatile ("" ::: "memory")
+#include "../src/pwm.c"
+
+void SysTick_Handler(void);
+
+#define SIM_CLOCK    168000000
+#define SIM_FRAME_MS 20 // 50Hz
+#define SIM_NOISE_US 3
+#define SIM_SPIKE_US 150
+
+/*
+ * @brief 䳻 ű 
+ */
+static struct {
+	uint32_t ms;     // ݱ  ð
+	uint16_t level;  // űⰡ  ޽,  
+	uint16_t output; //  pwmRead 
+} sim;
+
+/*
+ * @brief 1ms ,  ֱ⸶ ޽ ϳ   pwmRead
+ * @param spike: ̹ ӿ  
+ * @retval ̹ ޽ ޾ true
+ */
+static bool simStep(uint16_t spike) {
+	bool frame = false;
+	hostDwt.CYCCNT += SIM_CLOCK / 1000;
+	SysTick_Handler();
+	if(sim.ms++ % SIM_FRAME_MS == 0) {
+		const int noise = rand() % (2 * SIM_NOISE_US + 1) - SIM_NOISE_US;
+		pwmStore(0, (uint16_t)(sim.level + spike + noise));
+		frame = true;
+	}
+	uint16_t data[RC_CHANNEL_MAX];
+	pwmRead(data);
+	sim.output = data[0];
+	return frame;
+}
+
+/*
+ * @brief   msŭ 
+ */
+static void simRun(uint32_t ms) {
+	while(ms-- > 0) {
+		simStep(0);
+	}
+}
+
+/*
+ * @brief  ϳ   
+ * @param type:  ü
+ * @param rise: 90%  ð(ms)
+ * @param rms: 1ms  ȭ rms(us)
+ * @param spike: ũ  ִ밪(us)
+ * @retval 
+ */
+static void measure(pwmType_t type, uint32_t* rise, double* rms, uint16_t* spike) {
+	pwmFilterType = type;
+	pwmFilterReady = false;
+	memset(pwmHistory, 0, sizeof(pwmHistory));
+	sim.level = 1500;
+	simRun(1000);
+
+	// 
+	double sum = 0;
+	uint32_t n;
+	uint16_t last = sim.output;
+	for(n = 0; n < 10000; n++) {
+		simStep(0);
+		sum += (double)(sim.output - last) * (sim.output - last);
+		last = sim.output;
+	}
+	*rms = sqrt(sum / n);
+
+	// ,  迡  ٲ
+	while(sim.ms % SIM_FRAME_MS != 0) {
+		simStep(0);
+	}
+	sim.level = 1700;
+	const uint32_t start = sim.ms;
+	while(sim.output < 1500 + (1700 - 1500) * 9 / 10) {
+		simStep(0);
+		CHECK(sim.ms - start < 1000);
+	}
+	*rise = sim.ms - 1 - start; // ޽   ms pwmRead 0ms
+	simRun(1000);
+
+	//   ũ
+	while(sim.ms % SIM_FRAME_MS != 0) {
+		simStep(0);
+	}
+	simStep(SIM_SPIKE_US);
+	*spike = 0;
+	for(n = 0; n < 200; n++) {
+		const uint16_t off = (sim.output > 1700) ? sim.output - 1700 : 1700 - sim.output;
+		if(off > *spike) {
+			*spike = off;
+		}
+		simStep(0);
+	}
+}
+
+int main(void) {
+	const char* names[] = { "DISABLE", "ENABLE", "INTERPOLATE" };
+	uint32_t rise[3];
+	double rms[3];
+	uint16_t spike[3];
+	uint8_t t;
+
+	srand(1);
+	setSystemClock(SIM_CLOCK);
+	for(t = 0; t < 3; t++) {
+		measure((pwmType_t)t, &rise[t], &rms[t], &spike[t]);
+		printf("%-11s: 90%% %2u ms, rms change %.2f us/ms, spike %3u us\n", names[t], rise[t], rms[t], spike[t]);
+	}
+
+	// rc.h ǥ 
+	CHECK(rise[PWM_FILTER_DISABLE] == 0);
+	CHECK(spike[PWM_FILTER_DISABLE] >= SIM_SPIKE_US - 2 * SIM_NOISE_US);
+	for(t = PWM_FILTER_ENABLE; t <= PWM_FILTER_INTERPOLATE; t++) {
+		CHECK(rise[t] > SIM_FRAME_MS); // ߾Ӱ   
+		CHECK(rms[t] < rms[PWM_FILTER_DISABLE] / 2);
+		CHECK(spike[t] <= 2 * SIM_NOISE_US); // ũ ,  
+	}
+	CHECK(rise[PWM_FILTER_ENABLE] < rise[PWM_FILTER_INTERPOLATE]);
+	puts("pwm ok");
+	return 0;
+}
@@ -0,0 +1,97 @@
+#include "test.h"
+#include <system.h>
+
+/*
+ * Ŭ ī ð  
+ * DWT->CYCCNT(hostDwt)  ̰ SysTick_Handler 1ms ҷ 䳻
+ * ȣ  Ÿٿ timeBenchmark , ȣƮ ð ǹ̰ Ƿ Ȯ Ȯ
+ */
+
+void SysTick_Handler(void);
+
+static uint32_t hostClock;
+static uint64_t hostCycles; // 䳻 ü Ŭ 
+
+/*
+ * @brief Ŭ , 1ms 踶 SysTick ͷƮ
+ */
+static void advance(uint64_t cycles) {
+	const uint32_t tick = hostClock / 1000;
+	while(cycles > 0) {
+		const uint32_t toTick = tick - (uint32_t)(hostCycles % tick);
+		const uint32_t step = (cycles < toTick) ? (uint32_t)cycles : toTick;
+		hostCycles += step;
+		hostDwt.CYCCNT += step;
+		cycles -= step;
+		if(hostCycles % tick == 0) {
+			SysTick_Handler();
+		}
+	}
+}
+
+/*
+ * @brief   ȯ Ȯ  ۰ų , ̴ 1us +  2^-31 ̳
+ */
+static void conversion(void) {
+	const uint32_t clocks[] = { 168000000, 120000000, 84000000, 48000000, 16000000, 8000000 };
+	uint8_t i;
+	for(i = 0; i < sizeof(clocks) / sizeof(clocks[0]); i++) {
+		setSystemClock(clocks[i]);
+		uint64_t c;
+		uint32_t worst = 0;
+		// 2^40 Ŭ 168MHz  1.8ð
+		for(c = 1; c < ((uint64_t)1 << 40); c = c * 3 + 7) {
+			const uint64_t exact = c * 1000000 / clocks[i];
+			const uint64_t fast = cyclesToMicros(c);
+			CHECK(fast <= exact);
+			CHECK(exact - fast <= 1 + (exact >> 31));
+			if(exact - fast > worst) {
+				worst = (uint32_t)(exact - fast);
+			}
+		}
+		printf("%3u MHz: max conversion error %u us\n", clocks[i] / 1000000, worst);
+	}
+}
+
+/*
+ * @brief CYCCNT ĵ, Ŭ ٲ㵵 micros ̾
+ */
+static void continuity(void) {
+	hostClock = 168000000;
+	hostCycles = 0;
+	hostDwt.CYCCNT = 0xfff00000; //  ħ
+	setSystemClock(hostClock);
+	const uint64_t start = micros64();
+
+	// 60, CYCCNT  25ʸ ħ
+	uint32_t s;
+	uint64_t last = start;
+	for(s = 0; s < 60000; s++) {
+		advance(hostClock / 1000);
+		const uint64_t now = micros64();
+		CHECK(now > last);
+		last = now;
+	}
+	CHECK(last - start >= 60000000 - 1 && last - start <= 60000000);
+
+	// 48MHz ٲ  10
+	const uint64_t before = micros64();
+	hostClock = 48000000;
+	setSystemClock(hostClock);
+	hostCycles = 0; // SysTick 踦  Ŭ 
+	CHECK(micros64() == before);
+	for(s = 0; s < 10000; s++) {
+		advance(hostClock / 1000);
+	}
+	const uint64_t after = micros64();
+	CHECK(after - before >= 10000000 - 1 && after - before <= 10000000);
+	CHECK(millis() == 70000);
+	printf("60 s at 168 MHz + 10 s at 48 MHz: %llu us\n", (unsigned long long)(after - start));
+}
+
+int main(void) {
+	conversion();
+	continuity();
+	puts("time ok");
+	return 0;
+}
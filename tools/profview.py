@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+"""
+profiler.c 스냅샷 출력 도구
+
+사용법:
+    profview.py /dev/ttyUSB0 [-b 115200] [--reset]   보드에 'P'를 보내고 결과 출력
+    profview.py dump.bin                              저장된 스냅샷 파일 출력
+"""
+
+import argparse
+import struct
+import sys
+import time
+
+# src/profiler.h 의 profId_t 와 순서를 맞출것
+PROBE_NAMES = [
+    "SysTick", "UART", "I2C_EV", "I2C_ER", "EXTI", "PWM", "TIMER", "PPM", "DSHOT",
+    "USER_0", "USER_1", "USER_2", "USER_3", "USER_4", "USER_5", "USER_6", "USER_7",
+]
+
+SYNC = b"\xa5\x5a"
+HIST_SIZE = 16
+ENTRY_FMT = "<BIQII%dH" % HIST_SIZE
+ENTRY_SIZE = struct.calcsize(ENTRY_FMT)
+HEADER_FMT = "<BBIB"
+HEADER_SIZE = struct.calcsize(HEADER_FMT)
+
+
+def parse(data):
+    start = data.find(SYNC)
+    if start < 0:
+        raise ValueError("sync not found")
+    body = data[start + 2:]
+    version, count, clock, max_depth = struct.unpack_from(HEADER_FMT, body, 0)
+    if version != 1:
+        raise ValueError("unknown version %d" % version)
+    size = HEADER_SIZE + count * ENTRY_SIZE
+    if len(body) < size + 1:
+        raise ValueError("short snapshot")
+    checksum = 0
+    for b in body[:size]:
+        checksum ^= b
+    if checksum != body[size]:
+        raise ValueError("checksum mismatch")
+    entries = []
+    for i in range(count):
+        fields = struct.unpack_from(ENTRY_FMT, body, HEADER_SIZE + i * ENTRY_SIZE)
+        entries.append({
+            "id": fields[0], "count": fields[1], "total": fields[2],
+            "max": fields[3], "nested": fields[4], "hist": fields[5:],
+        })
+    return clock, max_depth, entries
+
+
+def render(clock, max_depth, entries):
+    mhz = clock / 1e6 if clock else 1.0
+    grand = sum(e["total"] for e in entries) or 1
+    print("clock %.0f MHz, max nesting %d" % (mhz, max_depth))
+    print("%-8s %10s %10s %10s %7s %8s  histogram(log2 cycles)" %
+          ("probe", "count", "avg(us)", "max(us)", "share", "nested"))
+    for e in sorted(entries, key=lambda e: -e["total"]):
+        name = PROBE_NAMES[e["id"]] if e["id"] < len(PROBE_NAMES) else "#%d" % e["id"]
+        avg = e["total"] / e["count"] / mhz
+        peak = max(e["hist"]) or 1
+        bars = "".join(" .:-=+*#%@"[min(9, (h * 9 + peak - 1) // peak)] for h in e["hist"])
+        print("%-8s %10d %10.2f %10.2f %6.1f%% %8d  |%s|" %
+              (name, e["count"], avg, e["max"] / mhz, 100.0 * e["total"] / grand, e["nested"], bars))
+
+
+def read_port(port, baud, reset):
+    import serial  # pyserial
+    with serial.Serial(port, baud, timeout=0.5) as ser:
+        ser.reset_input_buffer()
+        ser.write(b"P")
+        data = b""
+        deadline = time.time() + 2.0
+        while time.time() < deadline:
+            data += ser.read(4096)
+            try:
+                result = parse(data)
+                break
+            except ValueError:
+                continue
+        else:
+            raise ValueError("no valid snapshot received")
+        if reset:
+            ser.write(b"R")
+        return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("source", help="serial port or snapshot file")
+    parser.add_argument("-b", "--baud", type=int, default=115200)
+    parser.add_argument("--reset", action="store_true", help="reset counters after reading")
+    args = parser.parse_args()
+
+    if args.source.startswith("/dev/") or args.source.upper().startswith("COM"):
+        result = read_port(args.source, args.baud, args.reset)
+    else:
+        with open(args.source, "rb") as f:
+            result = parse(f.read())
+    render(*result)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
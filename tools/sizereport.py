@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+"""
+플래시/RAM 사용량 보고 도구
+
+사용법:
+    sizereport.py firmware.elf                      전체 사용량과 하드웨어 맵 테이블
+    sizereport.py firmware.elf build/*.o            오브젝트별 사용량도 출력
+    sizereport.py firmware.elf --prefix arm-none-eabi- --flash 1024 --ram 128
+
+하드웨어 맵(이름이 Map으로 끝나는 상수)이 두벌 이상 있으면 표시함, board.h로 옮긴 뒤에는 모두 한벌이어야함
+DMA가 접근하는 버퍼가 CCM(0x10000000 ~ 0x1000ffff)에 있으면 오류로 종료함
+CCM_ENABLE=1로 빌드할때는 링크 후 단계로 반드시 실행할것, 실패하면 빌드 실패(src/ccm.h)
+"""
+
+import argparse
+import subprocess
+import sys
+from collections import defaultdict
+
+FLASH_TYPES = "TtRrVvWw"
+DATA_TYPES = "Dd"
+
+CCM_START = 0x10000000
+CCM_END = 0x10010000
+
+# DMA가 직접 읽고 쓰는 버퍼, CCM에 있으면 DMA가 접근하지 못함
+DMA_SYMBOLS = ("uartBuf", "dshotTimer", "dshotEdge")
+
+
+def run(cmd):
+    try:
+        return subprocess.run(cmd, check=True, capture_output=True, text=True).stdout
+    except (OSError, subprocess.CalledProcessError) as e:
+        sys.exit("failed: %s (%s)" % (" ".join(cmd), e))
+
+
+def section_sizes(prefix, path):
+    # berkeley 형식: text data bss dec hex filename
+    out = run([prefix + "size", "-B", path]).splitlines()
+    rows = []
+    for line in out[1:]:
+        fields = line.split()
+        if len(fields) >= 6:
+            rows.append((int(fields[0]), int(fields[1]), int(fields[2]), fields[5]))
+    return rows
+
+
+def ccm_size(prefix, path):
+    # sysv 형식: section size addr
+    total = 0
+    for line in run([prefix + "size", "-A", "-d", path]).splitlines():
+        fields = line.split()
+        if len(fields) == 3 and fields[1].isdigit() and fields[2].isdigit():
+            if CCM_START <= int(fields[2]) < CCM_END:
+                total += int(fields[1])
+    return total
+
+
+def symbols(prefix, path):
+    out = run([prefix + "nm", "--print-size", "--size-sort", "--radix=d", path])
+    result = []
+    for line in out.splitlines():
+        fields = line.split()
+        if len(fields) == 4:
+            result.append((int(fields[0]), int(fields[1]), fields[2], fields[3]))
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("elf")
+    parser.add_argument("objs", nargs="*")
+    parser.add_argument("--prefix", default="arm-none-eabi-")
+    parser.add_argument("--flash", type=int, default=1024, help="flash size (KiB)")
+    parser.add_argument("--ram", type=int, default=128, help="main SRAM size (KiB), CCM excluded")
+    args = parser.parse_args()
+
+    text, data, bss, _ = section_sizes(args.prefix, args.elf)[0]
+    ccm = ccm_size(args.prefix, args.elf)
+    flash = text + data
+    ram = data + bss - ccm
+    print("flash %8d B  %5.1f%% of %d KiB" % (flash, 100.0 * flash / (args.flash * 1024), args.flash))
+    print("ram   %8d B  %5.1f%% of %d KiB  (data %d, bss %d)" % (ram, 100.0 * ram / (args.ram * 1024), args.ram, data, bss))
+    print("ccm   %8d B  %5.1f%% of %d KiB" % (ccm, 100.0 * ccm / (CCM_END - CCM_START), (CCM_END - CCM_START) // 1024))
+
+    if args.objs:
+        print()
+        print("%-24s %8s %8s %8s" % ("object", "flash", "data", "bss"))
+        rows = []
+        for obj in args.objs:
+            rows.extend(section_sizes(args.prefix, obj))
+        for text, data, bss, name in sorted(rows, key=lambda r: -(r[0] + r[1])):
+            print("%-24s %8d %8d %8d" % (name.split("/")[-1], text + data, data, bss))
+
+    syms = symbols(args.prefix, args.elf)
+    tables = defaultdict(list)
+    for _, size, kind, name in syms:
+        if name.endswith("Map") and kind in FLASH_TYPES + DATA_TYPES:
+            tables[name].append(size)
+    if tables:
+        print()
+        print("%-24s %8s %6s" % ("hardware map", "bytes", "copies"))
+        for name in sorted(tables):
+            sizes = tables[name]
+            mark = "  <- duplicated" if len(sizes) > 1 else ""
+            print("%-24s %8d %6d%s" % (name, sum(sizes), len(sizes), mark))
+
+    bad = [name for addr, _, _, name in syms if name in DMA_SYMBOLS and CCM_START <= addr < CCM_END]
+    if bad:
+        sys.exit("DMA buffer in CCM: %s" % ", ".join(bad))
+
+
+if __name__ == "__main__":
+    main()